@@ -0,0 +1,56 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#version 420 core
+
+in vec4 t_color;
+in vec2 t_coord;
+flat in float t_texindex;
+out vec4 o_color;
+
+layout(binding = 0) uniform sampler2D m_textures[16];
+
+// Samplers may only be indexed with dynamically uniform values, and the
+// index changes from sprite to sprite. Each slot gets its own branch, the
+// gradients are taken outside as branches are not uniform either.
+vec4 SampleSlot(int slot, vec2 coord, vec2 dx, vec2 dy)
+{
+    switch (slot)
+    {
+    case 0: return textureGrad(m_textures[0], coord, dx, dy);
+    case 1: return textureGrad(m_textures[1], coord, dx, dy);
+    case 2: return textureGrad(m_textures[2], coord, dx, dy);
+    case 3: return textureGrad(m_textures[3], coord, dx, dy);
+    case 4: return textureGrad(m_textures[4], coord, dx, dy);
+    case 5: return textureGrad(m_textures[5], coord, dx, dy);
+    case 6: return textureGrad(m_textures[6], coord, dx, dy);
+    case 7: return textureGrad(m_textures[7], coord, dx, dy);
+    case 8: return textureGrad(m_textures[8], coord, dx, dy);
+    case 9: return textureGrad(m_textures[9], coord, dx, dy);
+    case 10: return textureGrad(m_textures[10], coord, dx, dy);
+    case 11: return textureGrad(m_textures[11], coord, dx, dy);
+    case 12: return textureGrad(m_textures[12], coord, dx, dy);
+    case 13: return textureGrad(m_textures[13], coord, dx, dy);
+    case 14: return textureGrad(m_textures[14], coord, dx, dy);
+    default: return textureGrad(m_textures[15], coord, dx, dy);
+    }
+}
+
+void main()
+{
+    vec2 dx = dFdx(t_coord);
+    vec2 dy = dFdy(t_coord);
+    o_color = t_color * SampleSlot(int(t_texindex), t_coord, dx, dy);
+}
@@ -26,9 +26,10 @@ layout(std140, binding = 0) uniform Matrices {
 };
 
 uniform mat4 m_model;
+uniform vec4 m_texrect;
 out vec2 t_coord;
 
 void main() {
-    t_coord = m_tex;
+    t_coord = mix(m_texrect.xy, m_texrect.zw, m_tex);
     gl_Position = m_ortho * m_model * vec4(m_pos, 0.0, 1.0);
 }
\ No newline at end of file
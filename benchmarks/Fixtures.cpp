@@ -0,0 +1,105 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "Fixtures.h"
+#include "Graph/2D/SpriteNode.h"
+#include "Renderer/Buffers.h"
+#include "Renderer/VertexArray.h"
+#include "Renderer/ResourceManager.h"
+#include "Renderer/TextureLoader.h"
+#include "Renderer/Materials/BasicMaterial.h"
+
+// Distinct geometries handed out by CreateMesh
+static const uint32_t sMeshVariants = 8;
+
+Ref<Scene> CreateScene()
+{
+    auto scene = CreateRef<Scene>();
+    scene->Load();
+    return scene;
+}
+
+Ref<Mesh> CreateMesh(uint32_t variant)
+{
+    static std::vector<Ref<VertexArray>> geometries;
+    if (geometries.empty())
+    {
+        // A cube worth of vertices and indices
+        std::vector<float> vertices(8 * 3, 0.0f);
+        std::vector<uint32_t> indices(36, 0);
+        BufferLayout layout = {{ShaderDataType::Vec3, "m_pos"}};
+
+        for (uint32_t i = 0; i < sMeshVariants; i++)
+        {
+            auto vertexBuffer = VertexBuffer::Create(vertices.data(), (uint32_t)(vertices.size() * sizeof(float)));
+            vertexBuffer->SetLayout(layout);
+
+            auto geometry = VertexArray::Create();
+            geometry->AddVertexBuffer(vertexBuffer);
+            geometry->SetIndexBuffer(IndexBuffer::Create(indices.data(), (uint32_t)(indices.size() * sizeof(uint32_t))));
+            geometries.push_back(geometry);
+        }
+    }
+
+    auto material = ResourceManager::LoadMaterial<BasicMaterial>();
+    return CreateRef<Mesh>(geometries[variant % sMeshVariants], material);
+}
+
+Ref<Node3d> CreateChain(uint32_t depth)
+{
+    Ref<Node3d> root = CreateRef<MeshNode>(CreateMesh(0));
+    auto parent = root;
+    for (uint32_t i = 1; i < depth; i++)
+    {
+        auto node = CreateRef<MeshNode>(CreateMesh(i));
+        parent->AddChild(node);
+        parent = node;
+    }
+    return root;
+}
+
+Ref<Node3d> CreateFan(uint32_t children)
+{
+    Ref<Node3d> root = CreateRef<MeshNode>(CreateMesh(0));
+    for (uint32_t i = 0; i < children; i++)
+    {
+        root->AddChild(CreateRef<MeshNode>(CreateMesh(i)));
+    }
+    return root;
+}
+
+void AddSprites(const Ref<Scene> &scene, uint32_t count, const glm::vec2 &area)
+{
+    // Rows of sprites, wrapping around the area
+    uint32_t columns = std::max(1u, (uint32_t)(area.x / 16.0f));
+    for (uint32_t i = 0; i < count; i++)
+    {
+        auto sprite = CreateRef<SpriteNode>("assets/textures/container.jpg");
+        sprite->SetPosition(glm::vec2((i % columns) * 16.0f, std::fmod((i / columns) * 16.0f, area.y)));
+        sprite->SetSize(glm::vec2(16.0f, 16.0f));
+        scene->AddChild(sprite);
+    }
+}
+
+void FlushTextures()
+{
+    auto &loader = TextureLoader::Get();
+    while (loader.GetPendingCount() > 0)
+    {
+        loader.Upload();
+        loader.Dispatch();
+        std::this_thread::yield();
+    }
+}
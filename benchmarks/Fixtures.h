@@ -0,0 +1,53 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+#include "Core/Base.h"
+#include "Graph/Scene.h"
+#include "Graph/3D/Node3d.h"
+#include "Renderer/Mesh.h"
+#include "glm/glm.hpp"
+
+using namespace Antomic;
+
+// The engine has no concrete 3D node yet, this one draws a mesh
+class MeshNode : public Node3d
+{
+public:
+    MeshNode(const Ref<Mesh> &mesh) : mMesh(mesh) {}
+    virtual ~MeshNode() = default;
+
+protected:
+    virtual const Ref<Drawable> GetDrawable() const override { return mMesh; };
+
+private:
+    Ref<Mesh> mMesh;
+};
+
+// Scene with the camera the application would load it with
+Ref<Scene> CreateScene();
+
+// Meshes of the same variant share geometry and end up on one batch
+Ref<Mesh> CreateMesh(uint32_t variant);
+
+// Mesh node subtrees, one node per level or all nodes under the root
+Ref<Node3d> CreateChain(uint32_t depth);
+Ref<Node3d> CreateFan(uint32_t children);
+
+// Sprites spread over the viewport, all sharing one image
+void AddSprites(const Ref<Scene> &scene, uint32_t count, const glm::vec2 &area);
+
+// Runs the texture loads still pending to completion
+void FlushTextures();
@@ -0,0 +1,49 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "benchmark/benchmark.h"
+#include "Fixtures.h"
+
+// Moving the root dirties the whole subtree, every node then recomputes its
+// world matrix and bounds. Clean runs only walk the graph.
+static void UpdateScene(benchmark::State &state, const Ref<Node3d> &root)
+{
+    auto scene = CreateScene();
+    scene->AddChild(root);
+    scene->Update(0);
+
+    auto dirty = state.range(1) != 0;
+    for (auto _ : state)
+    {
+        if (dirty)
+        {
+            root->SetPosition(glm::vec3(1.0f, 0.0f, 0.0f));
+        }
+        scene->Update(16);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_NodeUpdateDeep(benchmark::State &state)
+{
+    UpdateScene(state, CreateChain((uint32_t)state.range(0)));
+}
+BENCHMARK(BM_NodeUpdateDeep)->ArgsProduct({{64, 512, 4096}, {0, 1}})->ArgNames({"depth", "dirty"});
+
+static void BM_NodeUpdateWide(benchmark::State &state)
+{
+    UpdateScene(state, CreateFan((uint32_t)state.range(0)));
+}
+BENCHMARK(BM_NodeUpdateWide)->ArgsProduct({{1 << 10, 1 << 13, 1 << 16}, {0, 1}})->ArgNames({"children", "dirty"});
@@ -0,0 +1,74 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "benchmark/benchmark.h"
+#include "Fixtures.h"
+#include "Renderer/MeshOptimizer.h"
+#include <random>
+
+// Grid of quads with its triangles in random order, the worst case an
+// exporter can hand over
+static void CreateGrid(uint32_t size, std::vector<uint32_t> &indices, std::vector<uint8_t> &vertices)
+{
+    vertices.resize((size + 1) * (size + 1) * sizeof(glm::vec3));
+    auto positions = reinterpret_cast<glm::vec3 *>(vertices.data());
+    for (uint32_t y = 0; y <= size; y++)
+    {
+        for (uint32_t x = 0; x <= size; x++)
+        {
+            positions[y * (size + 1) + x] = glm::vec3(x, y, 0.0f);
+        }
+    }
+
+    std::vector<uint32_t> quads(size * size);
+    for (uint32_t i = 0; i < quads.size(); i++)
+    {
+        quads[i] = i;
+    }
+    std::shuffle(quads.begin(), quads.end(), std::mt19937(7));
+
+    indices.clear();
+    for (auto quad : quads)
+    {
+        auto a = quad / size * (size + 1) + quad % size;
+        indices.insert(indices.end(), {a, a + 1, a + size + 2, a, a + size + 2, a + size + 1});
+    }
+}
+
+// Cook time cost of the pipeline, the counters are the gain it brings
+static void BM_MeshOptimize(benchmark::State &state)
+{
+    std::vector<uint32_t> sourceIndices, indices;
+    std::vector<uint8_t> sourceVertices, vertices;
+    CreateGrid((uint32_t)state.range(0), sourceIndices, sourceVertices);
+
+    MeshOptimizerReport report;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        indices = sourceIndices;
+        vertices = sourceVertices;
+        state.ResumeTiming();
+
+        report = MeshOptimizer::Optimize(indices, vertices, sizeof(glm::vec3));
+    }
+
+    state.SetItemsProcessed(state.iterations() * (sourceIndices.size() / 3));
+    state.counters["acmr_before"] = report.Before.ACMR;
+    state.counters["acmr_after"] = report.After.ACMR;
+    state.counters["atvr_before"] = report.Before.ATVR;
+    state.counters["atvr_after"] = report.After.ATVR;
+}
+BENCHMARK(BM_MeshOptimize)->Arg(64)->Arg(256)->Arg(512)->ArgName("grid")->Unit(benchmark::kMillisecond);
@@ -0,0 +1,115 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "benchmark/benchmark.h"
+#include "Fixtures.h"
+#include "Renderer/Buffers.h"
+#include "Renderer/Camera.h"
+#include "Renderer/Frustum.h"
+#include "Renderer/Renderer.h"
+#include "Renderer/RendererFrame.h"
+
+// Builds and draws a frame the way the renderer does, against the
+// renderer set up by main, the null one when running headless
+static void BM_SceneSubmitAndDraw(benchmark::State &state)
+{
+    auto meshes = (uint32_t)state.range(0);
+    auto sprites = (uint32_t)state.range(1);
+    RendererViewport viewport(800, 600);
+
+    // Top level subtrees are collected in parallel
+    auto scene = CreateScene();
+    for (uint32_t i = 0; i < meshes; i += 64)
+    {
+        scene->AddChild(CreateFan(std::min(64u, meshes - i) - 1));
+    }
+    AddSprites(scene, sprites, glm::vec2(viewport.Right, viewport.Bottom));
+    scene->Update(0);
+    FlushTextures();
+
+    auto projection = scene->GetActiveCamera()->GetProjectionMatrix(viewport);
+    auto ortho = OrthographicCamera::ProjectionMatrix(viewport);
+
+    RendererStats stats;
+    for (auto _ : state)
+    {
+        auto frame = CreateRef<RendererFrame>(viewport, scene->GetViewMatrix());
+        frame->SetProjection(projection, ortho);
+        frame->SetFrustum(Frustum(projection * frame->GetViewMatrix()));
+        scene->SubmitDrawables(frame);
+        frame->Sort();
+        frame->Draw();
+        stats = frame->GetStats();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (meshes + sprites));
+    state.counters["draws"] = (double)stats.DrawCalls;
+    state.counters["binds"] = (double)(stats.ShaderBinds + stats.TextureBinds + stats.VertexArrayBinds);
+}
+BENCHMARK(BM_SceneSubmitAndDraw)
+    ->Args({1024, 0})
+    ->Args({16384, 0})
+    ->Args({0, 1024})
+    ->Args({0, 16384})
+    ->Args({8192, 8192})
+    ->ArgNames({"meshes", "sprites"})
+    ->Unit(benchmark::kMicrosecond);
+
+// Layouts compute the std140 offsets of every element when built
+static void BM_UniformBufferLayout(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        UniformBufferLayout layout = {
+            {ShaderDataType::Mat4, "m_proj"},
+            {ShaderDataType::Mat4, "m_view"},
+            {ShaderDataType::Mat4, "m_projview"},
+            {ShaderDataType::Mat4, "m_ortho"},
+            {ShaderDataType::Mat3, "m_normal"},
+            {ShaderDataType::Vec4, "m_color"},
+            {ShaderDataType::Vec3, "m_light"},
+            {ShaderDataType::Vec2, "m_size"},
+            {ShaderDataType::Float, "m_time"},
+            {ShaderDataType::Int, "m_mode"},
+            {ShaderDataType::Bool, "m_enabled"}};
+        benchmark::DoNotOptimize(layout.Stride());
+    }
+}
+BENCHMARK(BM_UniformBufferLayout);
+
+// The per frame camera update, values looked up by name then flushed
+static void BM_UniformBufferUpdate(benchmark::State &state)
+{
+    UniformBufferLayout layout = {
+        {ShaderDataType::Mat4, "m_proj"},
+        {ShaderDataType::Mat4, "m_view"},
+        {ShaderDataType::Mat4, "m_projview"},
+        {ShaderDataType::Mat4, "m_ortho"}};
+    auto buffer = UniformBuffer::Create(layout, 0);
+
+    float step = 0.0f;
+    for (auto _ : state)
+    {
+        auto view = glm::mat4(1.0f + step);
+        buffer->SetValue("m_proj", glm::mat4(1.0f));
+        buffer->SetValue("m_view", view);
+        buffer->SetValue("m_projview", view);
+        buffer->SetValue("m_ortho", glm::mat4(1.0f));
+        benchmark::DoNotOptimize(buffer->Flush());
+        step += 1.0f;
+    }
+    state.SetBytesProcessed(state.iterations() * layout.Stride());
+}
+BENCHMARK(BM_UniformBufferUpdate);
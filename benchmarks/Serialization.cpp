@@ -0,0 +1,58 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "benchmark/benchmark.h"
+#include "Fixtures.h"
+
+static Ref<Scene> CreateSpriteScene(uint32_t count)
+{
+    auto scene = CreateScene();
+    AddSprites(scene, count, glm::vec2(800, 600));
+    FlushTextures();
+    return scene;
+}
+
+static void BM_SceneSerialize(benchmark::State &state)
+{
+    auto scene = CreateSpriteScene((uint32_t)state.range(0));
+
+    for (auto _ : state)
+    {
+        nlohmann::json json;
+        scene->Serialize(json);
+        benchmark::DoNotOptimize(json);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SceneSerialize)->RangeMultiplier(10)->Range(10000, 1000000)->ArgName("nodes")->Unit(benchmark::kMillisecond);
+
+static void BM_SceneDeserialize(benchmark::State &state)
+{
+    nlohmann::json json;
+    CreateSpriteScene((uint32_t)state.range(0))->Serialize(json);
+
+    for (auto _ : state)
+    {
+        auto scene = Scene::Deserialize(json["scene"]);
+
+        // Releasing the graph and its textures is not part of the load
+        state.PauseTiming();
+        FlushTextures();
+        scene = nullptr;
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SceneDeserialize)->RangeMultiplier(10)->Range(10000, 1000000)->ArgName("nodes")->Unit(benchmark::kMillisecond);
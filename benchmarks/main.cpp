@@ -0,0 +1,55 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "benchmark/benchmark.h"
+#include "Core/Log.h"
+#include "Platform/Platform.h"
+#include "Platform/Headless/Platform.h"
+#include "Renderer/Renderer.h"
+
+int main(int argc, char **argv)
+{
+    // Results are written as JSON so runs of different builds can be
+    // compared, unless another output is asked for
+    auto output = "--benchmark_out=" + (std::filesystem::current_path() / "benchmarks.json").string();
+    std::string format = "--benchmark_out_format=json";
+    std::vector<char *> args(argv, argv + argc);
+    if (std::none_of(args.begin(), args.end(), [](const char *arg) { return std::strncmp(arg, "--benchmark_out=", 16) == 0; }))
+    {
+        args.push_back(output.data());
+        args.push_back(format.data());
+    }
+
+    auto count = (int)args.size();
+    benchmark::Initialize(&count, args.data());
+    if (benchmark::ReportUnrecognizedArguments(count, args.data()))
+    {
+        return 1;
+    }
+
+    // No display needed, frames are recorded for the null render API
+    Antomic::Log::Init();
+    std::filesystem::current_path(ANTOMIC_SOURCE_DIR);
+    Antomic::Platform::SetupHeadlessPlatform(800, 600, "Antomic Benchmarks", Antomic::HeadlessSettings());
+
+    {
+        // Keeps the 2D batching and the texture loader up for every benchmark
+        Antomic::Renderer renderer(Antomic::RendererViewport(800, 600));
+        benchmark::RunSpecifiedBenchmarks();
+    }
+
+    benchmark::Shutdown();
+    return 0;
+}
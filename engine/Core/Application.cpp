@@ -16,7 +16,9 @@
 */
 #include "Core/Application.h"
 #include "Core/Log.h"
+#include "Core/Archive.h"
 #include "Platform/Platform.h"
+#include "Platform/Headless/Platform.h"
 #include "Events/ApplicationEvent.h"
 #include "Events/WindowEvent.h"
 #include "Events/MouseEvent.h"
@@ -24,6 +26,7 @@
 #include "Graph/Scene.h"
 #include "Renderer/Renderer.h"
 #include "Renderer/RendererWorker.h"
+#include "Renderer/ResourceManager.h"
 #include "glm/glm.hpp"
 #include <glm/gtc/matrix_transform.hpp>
 #include <nlohmann/json.hpp>
@@ -32,17 +35,17 @@ namespace Antomic
 {
     Application *Application::sInstance = nullptr;
 
+    // Built from the assets tree by the cooker
+    static const char *sArchivePath = "assets.pak";
+
     Application::Application(const std::string &title, uint32_t width, uint32_t height, RenderAPIDialect api)
     {
-        ANTOMIC_ASSERT(!sInstance, "Application: Application already running!");
-        Log::Init();
-
-        sInstance = this;
-        mRunning = false;
+        Init();
 
         auto _width = width;
         auto _height = height;
         auto _api = api;
+        Scope<HeadlessSettings> headless = nullptr;
 
         if (std::filesystem::exists("settings.json"))
         {
@@ -54,20 +57,79 @@ namespace Antomic
             _height = settingsJSON["height"];
             std::string api_str = settingsJSON["api"];
             _api = RenderAPIFromStr(api_str);
+
+            // Display-less runs, closed after the given number of frames
+            if (settingsJSON.contains("headless"))
+            {
+                auto &headlessJSON = settingsJSON["headless"];
+                headless = CreateScope<HeadlessSettings>();
+                headless->FrameTime = headlessJSON.value("frametime", headless->FrameTime);
+
+                uint64_t frames = headlessJSON.value("frames", (uint64_t)0);
+                if (frames > 0)
+                {
+                    HeadlessEvent close;
+                    close.Frame = frames - 1;
+                    close.Type = HeadlessEventType::Close;
+                    headless->Script.push_back(close);
+                }
+            }
+        }
+
+        auto ready = headless ? Platform::SetupHeadlessPlatform(_width, _height, title, *headless)
+                              : Platform::SetupPlatform(_width, _height, title, _api);
+        if (!ready)
+        {
+            ANTOMIC_INFO("Error creating initializing platform");
+            exit(1);
         }
 
-        if (!Platform::SetupPlatform(_width, _height, title, _api))
+        CreateRenderer(_width, _height);
+    }
+
+    Application::Application(const std::string &title, uint32_t width, uint32_t height, const HeadlessSettings &settings)
+    {
+        Init();
+
+        if (!Platform::SetupHeadlessPlatform(width, height, title, settings))
         {
             ANTOMIC_INFO("Error creating initializing platform");
             exit(1);
         }
 
+        CreateRenderer(width, height);
+    }
+
+    void Application::Init()
+    {
+        ANTOMIC_ASSERT(!sInstance, "Application: Application already running!");
+        Log::Init();
+
+        sInstance = this;
+        mRunning = false;
+
+        // Cooked assets, loose files under assets are used when missing
+        if (std::filesystem::exists(sArchivePath) && !Archive::Mount(sArchivePath))
+        {
+            ANTOMIC_ERROR("Application: Could not mount archive {0}", sArchivePath);
+        }
+    }
+
+    void Application::CreateRenderer(uint32_t width, uint32_t height)
+    {
         Platform::SetEventHandler(ANTOMIC_BIND_EVENT_FN(Application::OnEvent));
-        RendererViewport viewport = {0, 0, _width, _height};
+        RendererViewport viewport = {0, 0, width, height};
         mRenderer = CreateRef<Renderer>(viewport);
+        mWorker = CreateScope<RendererWorker>(mRenderer);
     }
 
-    void Application::Run()
+    Application::~Application()
+    {
+        // Joins the render thread if Run did not get to stop it
+        mWorker = nullptr;
+    }
+
+    void Application::Run(uint64_t frames)
     {
         if (mRunning)
             return;
@@ -76,16 +138,31 @@ namespace Antomic
 
         ANTOMIC_PROFILE_BEGIN_SESSION();
 
+        // Frames are built here and submitted on the render thread
+        mWorker->Start();
+
+        uint64_t frameCount = 0;
         while (mRunning)
         {
             Platform::ProcessEvents();
-            mRenderer->RenderFrame();
+            auto frame = mRenderer->BuildFrame();
+            if (frame != nullptr)
+            {
+                mWorker->Submit(frame);
+            }
+
+            if (frames > 0 && ++frameCount >= frames)
+            {
+                mRunning = false;
+            }
 #if ANTOMIC_PROFILE
             // Since we are profiling we just render one frame
             mRunning = false;
 #endif
         }
 
+        mWorker->Stop();
+
         ANTOMIC_PROFILE_END_SESSION();
 
         Platform::WindowClose();
@@ -97,15 +174,27 @@ namespace Antomic
 
     void Application::SetScene(const Ref<Scene> &scene)
     {
-        auto oldscene = mRenderer->GetCurrentScene();
-
-        scene->Load();
-        mRenderer->SetCurrentScene(scene);
+        // Loading and unloading may create or release render resources
+        RunOnRenderThread([this, &scene]() {
+            auto oldscene = mRenderer->GetCurrentScene();
+
+            scene->Load();
+            mRenderer->SetCurrentScene(scene);
+
+            if (oldscene != nullptr)
+            {
+                oldscene->Unload();
+                oldscene = nullptr;
+
+                // Release the resources only used by the old scene
+                ResourceManager::Collect();
+            }
+        });
+    }
 
-        if (oldscene != nullptr)
-        {
-            oldscene->Unload();
-        }
+    void Application::RunOnRenderThread(const std::function<void()> &task)
+    {
+        mWorker->Execute(task);
     }
 
     void Application::LoadScene(const std::string &name)
@@ -29,12 +29,16 @@ namespace Antomic
         Application() : Application("Application", 640, 480){};
         Application(const std::string &title) : Application(title, 640, 480){};
         Application(const std::string &title, uint32_t width, uint32_t height, RenderAPIDialect api = RenderAPIDialect::OPENGL);
-        virtual ~Application() = default;
+
+        // Runs without a window on the null renderer
+        Application(const std::string &title, uint32_t width, uint32_t height, const HeadlessSettings &settings);
+        virtual ~Application();
 
     public:
         // Control Operations
         void ToggleFullscreen(bool value);
-        void Run();
+        // Runs the given number of frames, zero runs until the window closes
+        void Run(uint64_t frames = 0);
 
         // Windows attributes
         inline uint32_t GetWidth() const { return Platform::GetWindowWidth(); }
@@ -61,14 +65,25 @@ namespace Antomic
         void SetScene(const Ref<Scene>& scene);
         void LoadScene(const std::string& name);
 
+        // Resources using the render context must be created through here
+        // once the application is running, nodes building meshes included.
+        // Releasing them from any thread is fine, the render thread deletes
+        // them before its next frame.
+        void RunOnRenderThread(const std::function<void()> &task);
+
     public:
         static Application &Current() { return *sInstance; }
 
+    private:
+        void Init();
+        void CreateRenderer(uint32_t width, uint32_t height);
+
     private:
         static Application *sInstance;
         bool mRunning;
         glm::mat4 mProjMatrix;
         Ref<Renderer> mRenderer;
+        Scope<RendererWorker> mWorker;
 
     };
 } // namespace Antomic
@@ -0,0 +1,305 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "enginepch.h"
+#include "Core/Archive.h"
+#include "Profiling/Instrumentor.h"
+
+#ifdef ANTOMIC_PLATFORM_WINDOWS
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Antomic
+{
+    static const char sMagic[4] = {'A', 'P', 'A', 'K'};
+
+    std::mutex Archive::sMutex;
+    std::vector<Scope<Archive>> Archive::sMounted;
+
+    Archive::~Archive()
+    {
+        Close();
+    }
+
+    bool Archive::Open(const std::string &path)
+    {
+        ANTOMIC_PROFILE_FUNCTION("Core");
+
+        Close();
+
+#ifdef ANTOMIC_PLATFORM_WINDOWS
+        auto file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER size;
+        auto mapping = GetFileSizeEx(file, &size) ? CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+        auto data = mapping != nullptr ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (data == nullptr)
+        {
+            if (mapping != nullptr)
+            {
+                CloseHandle(mapping);
+            }
+            CloseHandle(file);
+            return false;
+        }
+
+        mFile = file;
+        mMapping = mapping;
+        mData = (const uint8_t *)data;
+        mSize = (uint64_t)size.QuadPart;
+#else
+        auto file = open(path.c_str(), O_RDONLY);
+        if (file < 0)
+        {
+            return false;
+        }
+
+        // The mapping outlives the descriptor
+        struct stat info;
+        auto data = fstat(file, &info) == 0 && info.st_size > 0 ? mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, file, 0) : MAP_FAILED;
+        close(file);
+        if (data == MAP_FAILED)
+        {
+            return false;
+        }
+
+        mData = (const uint8_t *)data;
+        mSize = (uint64_t)info.st_size;
+#endif
+
+        // Everything is checked once here, lookups trust the table
+        Header header;
+        if (mSize < sizeof(Header))
+        {
+            Close();
+            return false;
+        }
+
+        std::memcpy(&header, mData, sizeof(Header));
+        auto tableSize = (uint64_t)header.EntryCount * sizeof(Entry);
+        if (std::memcmp(header.Magic, sMagic, sizeof(sMagic)) != 0 || header.Version != Version ||
+            header.TableOffset % Alignment != 0 || header.TableOffset > mSize || tableSize > mSize - header.TableOffset)
+        {
+            Close();
+            return false;
+        }
+
+        mEntries = (const Entry *)(mData + header.TableOffset);
+        mEntryCount = header.EntryCount;
+        for (uint32_t i = 0; i < mEntryCount; i++)
+        {
+            auto &entry = mEntries[i];
+            if (entry.Offset > mSize || entry.Size > mSize - entry.Offset || (i > 0 && mEntries[i - 1].Hash >= entry.Hash))
+            {
+                Close();
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void Archive::Close()
+    {
+        if (mData == nullptr)
+        {
+            return;
+        }
+
+#ifdef ANTOMIC_PLATFORM_WINDOWS
+        UnmapViewOfFile(mData);
+        CloseHandle(mMapping);
+        CloseHandle(mFile);
+        mMapping = nullptr;
+        mFile = nullptr;
+#else
+        munmap((void *)mData, mSize);
+#endif
+
+        mData = nullptr;
+        mSize = 0;
+        mEntries = nullptr;
+        mEntryCount = 0;
+    }
+
+    ArchiveBlob Archive::Find(const std::string &path) const
+    {
+        ArchiveBlob blob;
+        if (mData == nullptr)
+        {
+            return blob;
+        }
+
+        auto hash = Hash(path);
+        auto end = mEntries + mEntryCount;
+        auto entry = std::lower_bound(mEntries, end, hash, [](const Entry &entry, uint64_t hash) { return entry.Hash < hash; });
+        if (entry != end && entry->Hash == hash)
+        {
+            blob.Data = mData + entry->Offset;
+            blob.Size = entry->Size;
+        }
+        return blob;
+    }
+
+    bool Archive::Mount(const std::string &path)
+    {
+        auto archive = CreateScope<Archive>();
+        if (!archive->Open(path))
+        {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(sMutex);
+        sMounted.push_back(std::move(archive));
+        return true;
+    }
+
+    void Archive::UnmountAll()
+    {
+        std::lock_guard<std::mutex> lock(sMutex);
+        sMounted.clear();
+    }
+
+    ArchiveBlob Archive::Resolve(const std::string &path)
+    {
+        std::lock_guard<std::mutex> lock(sMutex);
+        for (auto it = sMounted.rbegin(); it != sMounted.rend(); it++)
+        {
+            auto blob = (*it)->Find(path);
+            if (blob.IsValid())
+            {
+                return blob;
+            }
+        }
+        return ArchiveBlob();
+    }
+
+    bool Archive::ReadFile(const std::string &path, std::string &contents)
+    {
+        auto blob = Resolve(path);
+        if (blob.IsValid())
+        {
+            contents.assign((const char *)blob.Data, blob.Size);
+            return true;
+        }
+
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+        {
+            return false;
+        }
+
+        contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        return true;
+    }
+
+    uint64_t Archive::Hash(const std::string &path)
+    {
+        // assets\a/../b.png and assets/b.png name the same file
+        auto normalized = std::filesystem::path(path).lexically_normal().generic_string();
+
+        uint64_t hash = 14695981039346656037ull;
+        for (auto c : normalized)
+        {
+            hash ^= (uint8_t)c;
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    /*************************************************************
+     * ArchiveWriter Implementation
+     *************************************************************/
+
+    bool ArchiveWriter::Add(const std::string &path, std::vector<uint8_t> contents)
+    {
+        return mFiles.emplace(Archive::Hash(path), std::move(contents)).second;
+    }
+
+    bool ArchiveWriter::AddFile(const std::string &path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+        {
+            return false;
+        }
+
+        std::vector<uint8_t> contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        return Add(path, std::move(contents));
+    }
+
+    bool ArchiveWriter::Write(const std::string &path) const
+    {
+        ANTOMIC_PROFILE_FUNCTION("Core");
+
+        auto align = [](uint64_t offset) { return (offset + Archive::Alignment - 1) & ~(uint64_t)(Archive::Alignment - 1); };
+
+        // Contents first, the table goes at the end once the offsets are known
+        std::vector<Archive::Entry> entries;
+        uint64_t offset = align(sizeof(Archive::Header));
+        for (auto &[hash, contents] : mFiles)
+        {
+            entries.push_back({hash, offset, contents.size()});
+            offset = align(offset + contents.size());
+        }
+
+        Archive::Header header = {};
+        std::memcpy(header.Magic, sMagic, sizeof(sMagic));
+        header.Version = Archive::Version;
+        header.EntryCount = (uint32_t)entries.size();
+        header.TableOffset = offset;
+
+        // Written to a temporary file first, a failed cook never leaves a
+        // truncated archive behind
+        auto temporary = path + ".tmp";
+        {
+            std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+            if (!file)
+            {
+                return false;
+            }
+
+            const char padding[Archive::Alignment] = {};
+            file.write((const char *)&header, sizeof(header));
+            file.write(padding, align(sizeof(header)) - sizeof(header));
+
+            for (auto &[hash, contents] : mFiles)
+            {
+                file.write((const char *)contents.data(), contents.size());
+                file.write(padding, align(contents.size()) - contents.size());
+            }
+
+            file.write((const char *)entries.data(), entries.size() * sizeof(Archive::Entry));
+            if (!file)
+            {
+                return false;
+            }
+        }
+
+        std::error_code error;
+        std::filesystem::rename(temporary, path, error);
+        return !error;
+    }
+
+} // namespace Antomic
@@ -0,0 +1,131 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+#include "Core/Base.h"
+
+namespace Antomic
+{
+    // Bytes of an archived file, pointing straight into the mapping
+    struct ArchiveBlob
+    {
+        const uint8_t *Data = nullptr;
+        uint64_t Size = 0;
+
+        inline bool IsValid() const { return Data != nullptr; }
+    };
+
+    /*************************************************************
+     * Archive Implementation
+     *************************************************************/
+
+    // Packed assets, a header, a table of contents sorted by path hash and
+    // the file contents aligned to 16 bytes. The archive is mapped once and
+    // read in place. Paths are stored as given to the cooker, relative to the
+    // working directory, e.g. assets/shaders/2d/vs_sprite.glsl
+    class Archive
+    {
+    public:
+        Archive() = default;
+        ~Archive();
+
+        Archive(const Archive &) = delete;
+        Archive &operator=(const Archive &) = delete;
+
+    public:
+        bool Open(const std::string &path);
+        void Close();
+
+        ArchiveBlob Find(const std::string &path) const;
+
+        inline bool IsOpen() const { return mData != nullptr; }
+        inline uint32_t GetEntryCount() const { return mEntryCount; }
+
+    public:
+        // Mounted archives are searched newest first. Mount before loading
+        // anything from them, blobs stay valid until the archive is unmounted
+        static bool Mount(const std::string &path);
+        static void UnmountAll();
+
+        // Looks up a path in the mounted archives
+        static ArchiveBlob Resolve(const std::string &path);
+
+        // Archive or loose file contents, false if neither exists
+        static bool ReadFile(const std::string &path, std::string &contents);
+
+        // 64 bit FNV-1a of the normalized path
+        static uint64_t Hash(const std::string &path);
+
+    public:
+        struct Header
+        {
+            char Magic[4];
+            uint32_t Version;
+            uint32_t EntryCount;
+            uint32_t Reserved;
+            uint64_t TableOffset;
+            uint64_t Padding;
+        };
+
+        struct Entry
+        {
+            uint64_t Hash;
+            uint64_t Offset;
+            uint64_t Size;
+        };
+
+        static const uint32_t Version = 1;
+        static const uint32_t Alignment = 16;
+
+    private:
+        const uint8_t *mData = nullptr;
+        uint64_t mSize = 0;
+        const Entry *mEntries = nullptr;
+        uint32_t mEntryCount = 0;
+
+#ifdef ANTOMIC_PLATFORM_WINDOWS
+        void *mFile = nullptr;
+        void *mMapping = nullptr;
+#endif
+
+        static std::mutex sMutex;
+        static std::vector<Scope<Archive>> sMounted;
+    };
+
+    /*************************************************************
+     * ArchiveWriter Implementation
+     *************************************************************/
+
+    // Builds archives, used by the cooker
+    class ArchiveWriter
+    {
+    public:
+        ArchiveWriter() = default;
+        ~ArchiveWriter() = default;
+
+    public:
+        // False if the path, or another one with the same hash, was added
+        bool Add(const std::string &path, std::vector<uint8_t> contents);
+        bool AddFile(const std::string &path);
+
+        bool Write(const std::string &path) const;
+
+        inline size_t GetEntryCount() const { return mFiles.size(); }
+
+    private:
+        std::map<uint64_t, std::vector<uint8_t>> mFiles;
+    };
+
+} // namespace Antomic
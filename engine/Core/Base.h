@@ -121,6 +121,7 @@ namespace Antomic
     class Drawable;
     class Texture;
     class Material;
+    class Mesh;
     class Camera;
     class PerspectiveCamera;
     class OrthographicCamera;
@@ -128,6 +129,13 @@ namespace Antomic
     class RendererFrame;
     class RendererWorker;
     class Sprite;
+    class StreamBuffer;
+    class CommandBuffer;
+    class Frustum;
+    class OcclusionBuffer;
+    struct Occluder;
+    class TextureAtlas;
+    class TextureRegion;
     struct RendererViewport;
 
     /*************************************************************
@@ -135,7 +143,9 @@ namespace Antomic
      *************************************************************/ 
 
     class Node;
+    class Node2d;
     class Scene;
+    class AABBTree;
 
 
 } // namespace Antomic
@@ -0,0 +1,132 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "enginepch.h"
+#include "Core/WorkerPool.h"
+#include "Core/Log.h"
+
+namespace Antomic
+{
+    WorkerPool::WorkerPool(uint32_t workers)
+    {
+        if (workers == 0)
+        {
+            workers = std::max(1u, std::thread::hardware_concurrency()) - 1;
+        }
+
+        for (uint32_t index = 0; index < workers; index++)
+        {
+            mWorkers.emplace_back(&WorkerPool::Run, this);
+        }
+    }
+
+    WorkerPool::~WorkerPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mRunning = false;
+        }
+        mWorkReady.notify_all();
+
+        for (auto &worker : mWorkers)
+        {
+            worker.join();
+        }
+    }
+
+    void WorkerPool::ParallelFor(uint32_t count, const std::function<void(uint32_t)> &task)
+    {
+        if (count <= 1 || mWorkers.empty())
+        {
+            for (uint32_t index = 0; index < count; index++)
+            {
+                task(index);
+            }
+            return;
+        }
+
+        std::lock_guard<std::mutex> run(mRunMutex);
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mTask = &task;
+            mCount = count;
+            mNext = 0;
+            mDone = 0;
+            mGeneration++;
+        }
+        mWorkReady.notify_all();
+
+        RunTasks(&task, count);
+
+        // Workers still inside the call would read the next one's indices
+        std::unique_lock<std::mutex> lock(mMutex);
+        mWorkDone.wait(lock, [this] { return mDone == mCount && mActive == 0; });
+        mTask = nullptr;
+        mCount = 0;
+    }
+
+    void WorkerPool::RunTasks(const std::function<void(uint32_t)> *task, uint32_t count)
+    {
+        uint32_t done = 0;
+        for (auto index = mNext++; index < count; index = mNext++)
+        {
+            (*task)(index);
+            done++;
+        }
+
+        if (done > 0)
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mDone += done;
+        }
+    }
+
+    void WorkerPool::Run()
+    {
+        uint64_t generation = 0;
+        std::unique_lock<std::mutex> lock(mMutex);
+        while (true)
+        {
+            mWorkReady.wait(lock, [this, generation] { return !mRunning || mGeneration != generation; });
+            if (!mRunning)
+            {
+                break;
+            }
+
+            // Calls already finished leave no task behind
+            generation = mGeneration;
+            auto task = mTask;
+            auto count = mCount;
+            if (task == nullptr)
+            {
+                continue;
+            }
+
+            mActive++;
+            lock.unlock();
+            RunTasks(task, count);
+            lock.lock();
+            mActive--;
+            mWorkDone.notify_all();
+        }
+    }
+
+    WorkerPool &WorkerPool::Get()
+    {
+        static WorkerPool instance;
+        return instance;
+    }
+
+} // namespace Antomic
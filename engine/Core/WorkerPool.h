@@ -0,0 +1,67 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+#include "Core/Base.h"
+
+namespace Antomic
+{
+    /*************************************************************
+     * WorkerPool Implementation
+     *************************************************************/
+
+    // Threads started once and kept for the whole run, per frame work is
+    // split across them instead of starting threads every frame
+    class WorkerPool
+    {
+    public:
+        // Zero workers starts one less than the hardware threads, the
+        // caller of ParallelFor is the remaining one
+        WorkerPool(uint32_t workers = 0);
+        ~WorkerPool();
+
+    public:
+        // Runs task for every index below count, the caller takes part and
+        // returns once all of them are done. Calls from several threads
+        // run one after the other, tasks must not call it again.
+        void ParallelFor(uint32_t count, const std::function<void(uint32_t)> &task);
+
+        inline uint32_t GetWorkerCount() const { return (uint32_t)mWorkers.size(); }
+
+    public:
+        static WorkerPool &Get();
+
+    private:
+        void Run();
+        void RunTasks(const std::function<void(uint32_t)> *task, uint32_t count);
+
+    private:
+        std::vector<std::thread> mWorkers;
+        std::mutex mRunMutex;
+        std::mutex mMutex;
+        std::condition_variable mWorkReady;
+        std::condition_variable mWorkDone;
+        bool mRunning = true;
+
+        // Current call, workers take the next index until count is reached
+        const std::function<void(uint32_t)> *mTask = nullptr;
+        uint32_t mCount = 0;
+        std::atomic<uint32_t> mNext{0};
+        uint32_t mDone = 0;
+        uint32_t mActive = 0;
+        uint64_t mGeneration = 0;
+    };
+
+} // namespace Antomic
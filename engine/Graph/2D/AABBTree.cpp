@@ -0,0 +1,262 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "enginepch.h"
+#include "Graph/2D/AABBTree.h"
+#include "Core/Log.h"
+
+namespace Antomic
+{
+    int32_t AABBTree::Insert(const Rect &rect, void *userData)
+    {
+        auto proxy = AllocateNode();
+        auto &node = mNodes[proxy];
+        node.Tight = rect;
+        node.Box = Rect(rect.Min - glm::vec2(mMargin), rect.Max + glm::vec2(mMargin));
+        node.UserData = userData;
+        node.Height = 0;
+
+        InsertLeaf(proxy);
+        mProxyCount++;
+        return proxy;
+    }
+
+    void AABBTree::Remove(int32_t proxy)
+    {
+        ANTOMIC_ASSERT(proxy >= 0 && proxy < (int32_t)mNodes.size() && mNodes[proxy].IsLeaf(), "AABBTree: invalid proxy");
+        RemoveLeaf(proxy);
+        FreeNode(proxy);
+        mProxyCount--;
+    }
+
+    bool AABBTree::Move(int32_t proxy, const Rect &rect)
+    {
+        ANTOMIC_ASSERT(proxy >= 0 && proxy < (int32_t)mNodes.size() && mNodes[proxy].IsLeaf(), "AABBTree: invalid proxy");
+        auto &node = mNodes[proxy];
+        node.Tight = rect;
+        if (node.Box.Contains(rect))
+        {
+            return false;
+        }
+
+        RemoveLeaf(proxy);
+        mNodes[proxy].Box = Rect(rect.Min - glm::vec2(mMargin), rect.Max + glm::vec2(mMargin));
+        InsertLeaf(proxy);
+        return true;
+    }
+
+    int32_t AABBTree::AllocateNode()
+    {
+        if (mFreeList == sNullNode)
+        {
+            mNodes.emplace_back();
+            return (int32_t)mNodes.size() - 1;
+        }
+
+        auto index = mFreeList;
+        mFreeList = mNodes[index].Parent;
+        mNodes[index] = TreeNode();
+        return index;
+    }
+
+    void AABBTree::FreeNode(int32_t index)
+    {
+        auto &node = mNodes[index];
+        node.Parent = mFreeList;
+        node.Left = sNullNode;
+        node.Right = sNullNode;
+        node.UserData = nullptr;
+        node.Height = -1;
+        mFreeList = index;
+    }
+
+    void AABBTree::InsertLeaf(int32_t leaf)
+    {
+        if (mRoot == sNullNode)
+        {
+            mRoot = leaf;
+            mNodes[leaf].Parent = sNullNode;
+            return;
+        }
+
+        // Walk down choosing the child with the lowest perimeter growth
+        auto box = mNodes[leaf].Box;
+        auto index = mRoot;
+        while (!mNodes[index].IsLeaf())
+        {
+            auto left = mNodes[index].Left;
+            auto right = mNodes[index].Right;
+
+            auto perimeter = mNodes[index].Box.Perimeter();
+            auto combined = Rect::Merge(mNodes[index].Box, box).Perimeter();
+
+            // Cost of a new parent here, and the inherited cost further down
+            auto cost = 2.0f * combined;
+            auto inherited = 2.0f * (combined - perimeter);
+
+            auto descend = [&](int32_t child) {
+                auto merged = Rect::Merge(box, mNodes[child].Box).Perimeter();
+                if (mNodes[child].IsLeaf())
+                {
+                    return merged + inherited;
+                }
+                return merged - mNodes[child].Box.Perimeter() + inherited;
+            };
+
+            auto costLeft = descend(left);
+            auto costRight = descend(right);
+            if (cost < costLeft && cost < costRight)
+            {
+                break;
+            }
+
+            index = costLeft < costRight ? left : right;
+        }
+
+        // New parent for the sibling and the leaf
+        auto sibling = index;
+        auto oldParent = mNodes[sibling].Parent;
+        auto newParent = AllocateNode();
+        mNodes[newParent].Parent = oldParent;
+        mNodes[newParent].Box = Rect::Merge(box, mNodes[sibling].Box);
+        mNodes[newParent].Height = mNodes[sibling].Height + 1;
+        mNodes[newParent].Left = sibling;
+        mNodes[newParent].Right = leaf;
+        mNodes[sibling].Parent = newParent;
+        mNodes[leaf].Parent = newParent;
+
+        if (oldParent == sNullNode)
+        {
+            mRoot = newParent;
+        }
+        else if (mNodes[oldParent].Left == sibling)
+        {
+            mNodes[oldParent].Left = newParent;
+        }
+        else
+        {
+            mNodes[oldParent].Right = newParent;
+        }
+
+        Refit(newParent);
+    }
+
+    void AABBTree::RemoveLeaf(int32_t leaf)
+    {
+        if (leaf == mRoot)
+        {
+            mRoot = sNullNode;
+            return;
+        }
+
+        auto parent = mNodes[leaf].Parent;
+        auto grandParent = mNodes[parent].Parent;
+        auto sibling = mNodes[parent].Left == leaf ? mNodes[parent].Right : mNodes[parent].Left;
+
+        FreeNode(parent);
+        mNodes[sibling].Parent = grandParent;
+        if (grandParent == sNullNode)
+        {
+            mRoot = sibling;
+            return;
+        }
+
+        if (mNodes[grandParent].Left == parent)
+        {
+            mNodes[grandParent].Left = sibling;
+        }
+        else
+        {
+            mNodes[grandParent].Right = sibling;
+        }
+
+        Refit(grandParent);
+    }
+
+    void AABBTree::Refit(int32_t index)
+    {
+        // Rebalance and fix boxes up to the root
+        while (index != sNullNode)
+        {
+            index = Balance(index);
+
+            auto &node = mNodes[index];
+            auto &left = mNodes[node.Left];
+            auto &right = mNodes[node.Right];
+            node.Height = 1 + std::max(left.Height, right.Height);
+            node.Box = Rect::Merge(left.Box, right.Box);
+
+            index = node.Parent;
+        }
+    }
+
+    int32_t AABBTree::Balance(int32_t a)
+    {
+        // Rotates the taller child up when the subtree is unbalanced,
+        // returns the new root of the subtree
+        if (mNodes[a].IsLeaf() || mNodes[a].Height < 2)
+        {
+            return a;
+        }
+
+        auto b = mNodes[a].Left;
+        auto c = mNodes[a].Right;
+        auto balance = mNodes[c].Height - mNodes[b].Height;
+        if (balance > -2 && balance < 2)
+        {
+            return a;
+        }
+
+        // Promote the taller child, which is never a leaf here
+        auto up = balance > 0 ? c : b;
+        auto other = balance > 0 ? b : c;
+        auto f = mNodes[up].Left;
+        auto g = mNodes[up].Right;
+
+        mNodes[up].Left = a;
+        mNodes[up].Parent = mNodes[a].Parent;
+        mNodes[a].Parent = up;
+
+        if (mNodes[up].Parent == sNullNode)
+        {
+            mRoot = up;
+        }
+        else if (mNodes[mNodes[up].Parent].Left == a)
+        {
+            mNodes[mNodes[up].Parent].Left = up;
+        }
+        else
+        {
+            mNodes[mNodes[up].Parent].Right = up;
+        }
+
+        // The taller grandchild stays under the promoted node
+        auto keep = mNodes[f].Height > mNodes[g].Height ? f : g;
+        auto give = keep == f ? g : f;
+        mNodes[up].Right = keep;
+        mNodes[a].Left = other;
+        mNodes[a].Right = give;
+        mNodes[give].Parent = a;
+        mNodes[other].Parent = a;
+
+        mNodes[a].Box = Rect::Merge(mNodes[other].Box, mNodes[give].Box);
+        mNodes[a].Height = 1 + std::max(mNodes[other].Height, mNodes[give].Height);
+        mNodes[up].Box = Rect::Merge(mNodes[a].Box, mNodes[keep].Box);
+        mNodes[up].Height = 1 + std::max(mNodes[a].Height, mNodes[keep].Height);
+
+        return up;
+    }
+
+} // namespace Antomic
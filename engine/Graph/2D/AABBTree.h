@@ -0,0 +1,126 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+#include "Core/Base.h"
+#include "Renderer/Bounds.h"
+#include "glm/glm.hpp"
+
+namespace Antomic
+{
+    /*************************************************************
+     * AABBTree Implementation
+     *************************************************************/
+
+    // Dynamic bounding volume tree, as used by physics broadphases. Leaves
+    // keep a box fattened by a margin so small moves do not touch the tree,
+    // the tree is kept balanced with rotations. Queries are O(log n).
+    class AABBTree
+    {
+    public:
+        AABBTree(float margin = 8.0f) : mMargin(margin) {}
+        ~AABBTree() = default;
+
+    public:
+        // Proxy operations, proxies are stable ids for the inserted rects
+        int32_t Insert(const Rect &rect, void *userData);
+        void Remove(int32_t proxy);
+
+        // Returns true if the proxy left its fat box and was re-inserted
+        bool Move(int32_t proxy, const Rect &rect);
+
+        inline void *GetUserData(int32_t proxy) const { return mNodes[proxy].UserData; }
+        inline const Rect &GetRect(int32_t proxy) const { return mNodes[proxy].Tight; }
+        inline const Rect &GetFatRect(int32_t proxy) const { return mNodes[proxy].Box; }
+        inline uint32_t GetProxyCount() const { return mProxyCount; }
+        inline int32_t GetHeight() const { return mRoot == sNullNode ? 0 : mNodes[mRoot].Height; }
+
+        // Calls callback(proxy, userData) for every rect overlapping the query
+        template <typename F>
+        void Query(const Rect &rect, F &&callback) const
+        {
+            if (mRoot == sNullNode)
+            {
+                return;
+            }
+
+            std::vector<int32_t> stack;
+            stack.reserve(64);
+            stack.push_back(mRoot);
+            while (!stack.empty())
+            {
+                auto &node = mNodes[stack.back()];
+                auto index = stack.back();
+                stack.pop_back();
+
+                if (!node.Box.Overlaps(rect))
+                {
+                    continue;
+                }
+
+                if (node.IsLeaf())
+                {
+                    if (node.Tight.Overlaps(rect))
+                    {
+                        callback(index, node.UserData);
+                    }
+                    continue;
+                }
+
+                stack.push_back(node.Left);
+                stack.push_back(node.Right);
+            }
+        }
+
+        template <typename F>
+        void Query(const glm::vec2 &point, F &&callback) const
+        {
+            Query(Rect(point, point), std::forward<F>(callback));
+        }
+
+    private:
+        struct TreeNode
+        {
+            Rect Box;
+            Rect Tight;
+            void *UserData = nullptr;
+            // Parent while in the tree, next free node while in the free list
+            int32_t Parent = sNullNode;
+            int32_t Left = sNullNode;
+            int32_t Right = sNullNode;
+            // Leaves are 0, free nodes -1
+            int32_t Height = -1;
+
+            inline bool IsLeaf() const { return Left == sNullNode; }
+        };
+
+    private:
+        int32_t AllocateNode();
+        void FreeNode(int32_t index);
+        void InsertLeaf(int32_t leaf);
+        void RemoveLeaf(int32_t leaf);
+        int32_t Balance(int32_t index);
+        void Refit(int32_t index);
+
+    private:
+        static constexpr int32_t sNullNode = -1;
+        std::vector<TreeNode> mNodes;
+        int32_t mRoot = sNullNode;
+        int32_t mFreeList = sNullNode;
+        uint32_t mProxyCount = 0;
+        float mMargin;
+    };
+
+} // namespace Antomic
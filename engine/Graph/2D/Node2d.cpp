@@ -14,6 +14,8 @@ c       http://www.apache.org/licenses/LICENSE-2.0
    limitations under the License.
 */
 #include "Graph/2D/Node2d.h"
+#include "Graph/2D/AABBTree.h"
+#include "Graph/Scene.h"
 #include "Renderer/Sprite.h"
 #include "Renderer/Drawable.h"
 #include "Renderer/RendererFrame.h"
@@ -24,6 +26,14 @@ c       http://www.apache.org/licenses/LICENSE-2.0
 #include <glm/gtx/matrix_transform_2d.hpp>
 namespace Antomic
 {
+	Node2d::~Node2d()
+	{
+		if (mIndex != nullptr)
+		{
+			mIndex->Remove(mProxy);
+		}
+	}
+
 	const glm::mat3& Node2d::GetWorldMatrix()
 	{
 		UpdateSpatialInformation();
@@ -63,6 +73,10 @@ namespace Antomic
 	void Node2d::SetZOrder(int zorder)
 	{
 		mZOrder = zorder;
+		if (GetDrawable() != nullptr)
+		{
+			GetDrawable()->SetZOrder(zorder);
+		}
 	}
 
 	void Node2d::UpdateSpatialInformation()
@@ -92,6 +106,70 @@ namespace Antomic
 			glm::vec4(glm::vec2(mWorld[2]), 0, 1)));
 
 		ClearDirty();
+		UpdateIndex();
+	}
+
+	Rect Node2d::GetWorldRect()
+	{
+		// The sprite quad is the unit square in node space
+		return Rect(glm::vec2(0.0f), glm::vec2(1.0f)).Transform(GetWorldMatrix());
+	}
+
+	void Node2d::UpdateIndex()
+	{
+		// Only nodes with a drawable are indexed
+		if (GetDrawable() == nullptr)
+		{
+			return;
+		}
+
+		if (mIndex != nullptr)
+		{
+			mIndex->Move(mProxy, GetWorldRect());
+			return;
+		}
+
+		// Registers with the scene the node is attached to
+		auto root = GetParent();
+		while (root != nullptr && root->GetType() != NodeType::SCENE)
+		{
+			root = root->GetParent();
+		}
+
+		if (root == nullptr)
+		{
+			return;
+		}
+
+		auto scene = std::static_pointer_cast<Scene>(root);
+		mIndex = scene->GetSpatialIndex2d();
+		mProxy = mIndex->Insert(GetWorldRect(), this);
+		scene->InvalidateSubmitOrder();
+	}
+
+	void Node2d::CollectDrawables(DrawableCollector& collector)
+	{
+		if (mIndex == nullptr && GetDrawable() != nullptr)
+		{
+			collector.Drawables.push_back(GetDrawable());
+		}
+
+		for (auto& child : GetChildren())
+		{
+			child->CollectDrawables(collector);
+		}
+	}
+
+	void Node2d::OnRemoved()
+	{
+		// Registered again on the next update once attached to a scene
+		if (mIndex != nullptr)
+		{
+			mIndex->Remove(mProxy);
+			mIndex = nullptr;
+			mProxy = -1;
+		}
+		Node::OnRemoved();
 	}
 
 	// Serialization
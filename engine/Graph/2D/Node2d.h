@@ -16,6 +16,7 @@
 #pragma once
 #include "Core/Base.h"
 #include "Graph/Node.h"
+#include "Renderer/Bounds.h"
 #include "glm/glm.hpp"
 
 namespace Antomic
@@ -23,7 +24,7 @@ namespace Antomic
     class Node2d : public Node
     {
     public:
-        virtual ~Node2d() = default;
+        virtual ~Node2d();
 
     public:
         // Graph operations
@@ -45,11 +46,33 @@ namespace Antomic
         void SetAnchor(const glm::vec2 &anchor);
         void SetZOrder(int zorder);
 
+        // Rect covered by the node in world space
+        Rect GetWorldRect();
+
+        // Position of the node in a walk of its scene graph, sprites found
+        // through the index are submitted in this order. Kept by the scene,
+        // renumbered before its next query once nodes were added.
+        inline uint64_t GetSubmitOrder() const { return mSubmitOrder; }
+
+        // Nodes registered with a scene index are submitted through it,
+        // only the drawables of their children are collected
+        virtual void CollectDrawables(DrawableCollector &collector) override;
+
         // Serialization
         virtual void Serialize(nlohmann::json &json) override;
 
     protected:
         virtual void UpdateSpatialInformation() override;
+        virtual void OnRemoved() override;
+
+    private:
+        void UpdateIndex();
+
+    private:
+        friend class Scene;
+        Ref<AABBTree> mIndex = nullptr;
+        int32_t mProxy = -1;
+        uint64_t mSubmitOrder = 0;
 
 #ifdef ANTOMIC_TESTS
     protected:
@@ -16,30 +16,28 @@
 #include "Graph/2D/SpriteNode.h"
 #include "Renderer/Sprite.h"
 #include "Renderer/Texture.h"
+#include "Renderer/TextureAtlas.h"
+#include "Renderer/ResourceManager.h"
 #include "Renderer/RendererFrame.h"
 #include "Core/Serialization.h"
-#include "stb_image.h"
 #include <glm/gtx/matrix_transform_2d.hpp>
 #include "Profiling/Instrumentor.h"
 
 namespace Antomic
 {
 	SpriteNode::SpriteNode(const std::string name)
-		: mUrl(name)
+		: mUrl(name), mSprite(CreateRef<Sprite>())
 	{
-		{
-			mSprite = CreateRef<Sprite>();
-			// TODO: change the way we load resources
-			// load and generate the texture
-			int width, height, nrChannels;
-			unsigned char* data = stbi_load(name.c_str(), &width, &height, &nrChannels, 0);
-			if (data)
+		// Decoded and uploaded in the background, sprites sharing the same
+		// image share the atlas region. The sprite draws the placeholder
+		// until then.
+		auto sprite = mSprite;
+		ResourceManager::LoadTexture(name, [sprite](const Ref<TextureRegion>& region) {
+			if (region != nullptr)
 			{
-				Ref<Texture> texture = Texture::CreateTexture(width, height, data);
-				mSprite->AddBindable(texture);
+				sprite->SetTextureRegion(region);
 			}
-			stbi_image_free(data);
-		}
+		});
 	}
 
 	// Serialization
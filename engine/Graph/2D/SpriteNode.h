@@ -24,6 +24,7 @@ namespace Antomic
     class SpriteNode : public Node2d
     {
     public:
+        // Name is an image path, KTX2 and DDS files are loaded compressed
         SpriteNode(const std::string name);
         virtual ~SpriteNode() = default;
 
@@ -17,6 +17,8 @@
 #include "Renderer/Drawable.h"
 #include "Renderer/Mesh.h"
 #include "Renderer/RendererFrame.h"
+#include "Renderer/Frustum.h"
+#include "Renderer/OcclusionBuffer.h"
 #include "Core/Log.h"
 #include "Profiling/Instrumentor.h"
 #include <glm/glm.hpp>
@@ -56,6 +58,94 @@ namespace Antomic
         MakeDirty();
     }
 
+    void Node3d::Update(const uint32_t &time)
+    {
+        // Children bounds are ready once the subtree is updated
+        Node::Update(time);
+        UpdateBounds();
+    }
+
+    void Node3d::UpdateBounds()
+    {
+        mWorldBounds = BoundingBox();
+        mDrawableBounds = BoundingBox();
+        mDrawableCount = 0;
+
+        auto drawable = GetDrawable();
+        if (drawable != nullptr)
+        {
+            mDrawableBounds = drawable->GetBounds().Transform(mWorld);
+            mWorldBounds.Merge(mDrawableBounds);
+            mDrawableCount++;
+        }
+
+        // Node3d only accepts Node3d children
+        for (auto &child : GetChildren())
+        {
+            auto node = std::static_pointer_cast<Node3d>(child);
+            mWorldBounds.Merge(node->mWorldBounds);
+            mDrawableCount += node->mDrawableCount;
+        }
+    }
+
+    void Node3d::CollectDrawables(DrawableCollector &collector)
+    {
+        auto view = collector.View;
+        auto occlusion = collector.Occlusion;
+        if (view == nullptr && occlusion == nullptr)
+        {
+            Node::CollectDrawables(collector);
+            return;
+        }
+
+        auto test = view != nullptr ? view->Test(mWorldBounds) : FrustumTest::INSIDE;
+        if (test == FrustumTest::OUTSIDE || (occlusion != nullptr && occlusion->IsOccluded(mWorldBounds)))
+        {
+            collector.Culled += mDrawableCount;
+            return;
+        }
+
+        // Nothing below can be outside, skip the frustum tests
+        if (test == FrustumTest::INSIDE)
+        {
+            collector.View = nullptr;
+        }
+
+        // Without children the subtree bounds are the drawable bounds
+        auto drawable = GetDrawable();
+        if (drawable != nullptr)
+        {
+            if ((collector.View != nullptr && collector.View->Test(mDrawableBounds) == FrustumTest::OUTSIDE) ||
+                (occlusion != nullptr && GetChildren().size() > 0 && occlusion->IsOccluded(mDrawableBounds)))
+            {
+                collector.Culled++;
+            }
+            else
+            {
+                collector.Drawables.push_back(drawable);
+            }
+        }
+
+        for (auto &child : GetChildren())
+        {
+            child->CollectDrawables(collector);
+        }
+        collector.View = view;
+    }
+
+    void Node3d::CollectOccluders(OcclusionBuffer &buffer)
+    {
+        if (mOccluder != nullptr)
+        {
+            buffer.AddOccluder(mOccluder, mWorld);
+        }
+
+        for (auto &child : GetChildren())
+        {
+            std::static_pointer_cast<Node3d>(child)->CollectOccluders(buffer);
+        }
+    }
+
     void Node3d::UpdateSpatialInformation()
     {
         if (!IsDirty())
@@ -16,6 +16,7 @@
 #pragma once
 #include "Core/Base.h"
 #include "Graph/Node.h"
+#include "Renderer/Bounds.h"
 #include "glm/glm.hpp"
 
 namespace Antomic
@@ -43,9 +44,22 @@ namespace Antomic
         void SetPosition(const glm::vec3 &position);
         void SetSize(const glm::vec3 &size);
         void SetRotation(const glm::vec3 &rotation);
+
+        // World bounds of the subtree, refreshed on Update after the children
+        inline const BoundingBox &GetWorldBounds() const { return mWorldBounds; }
+
+        // Geometry rasterized into the occlusion buffer, hides the nodes behind it
+        inline const Ref<Occluder> &GetOccluder() const { return mOccluder; }
+        inline void SetOccluder(const Ref<Occluder> &occluder) { mOccluder = occluder; }
+
+        // State & Render Operations
+        virtual void Update(const uint32_t &time) override;
+        virtual void CollectDrawables(DrawableCollector &collector) override;
+        void CollectOccluders(OcclusionBuffer &buffer);
  
     protected:
         virtual void UpdateSpatialInformation() override;
+        void UpdateBounds();
 
 #ifdef ANTOMIC_TESTS
     protected:
@@ -57,5 +71,9 @@ namespace Antomic
         glm::vec3 mPosition = {0,0,0};
         glm::vec3 mSize = {1,1,1};
         glm::vec3 mRotation = {0,0,0};
+        BoundingBox mWorldBounds;
+        BoundingBox mDrawableBounds;
+        uint32_t mDrawableCount = 0;
+        Ref<Occluder> mOccluder;
     };
 } // namespace Antomic
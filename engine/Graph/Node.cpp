@@ -54,9 +54,19 @@ namespace Antomic
 		ANTOMIC_ASSERT(node->mParent.get() == this, "Node: Not a child of this node");
 		auto child = std::find(mChildren.begin(), mChildren.end(), node);
 		(*child)->mParent = nullptr;
+		(*child)->OnRemoved();
+		(*child)->MakeDirty();
 		mChildren.erase(child);
 	}
 
+	void Node::OnRemoved()
+	{
+		for (auto& child : mChildren)
+		{
+			child->OnRemoved();
+		}
+	}
+
 	void Node::MakeDirty()
 	{
 		mDirty = true;
@@ -78,20 +88,30 @@ namespace Antomic
 
 	void Node::SubmitDrawables(const Ref<RendererFrame>& frame)
 	{
-		// TODO: Optimize in order only to send drawables that are inside the view
-
 		ANTOMIC_PROFILE_FUNCTION("Graph");
 
-		// Submit any existing drawable if it exists
+		// Only drawables inside the view reach the frame
+		DrawableCollector collector;
+		collector.View = &frame->GetFrustum();
+		CollectDrawables(collector);
+
+		for (auto& drawable : collector.Drawables)
+		{
+			frame->QueueDrawable(drawable);
+		}
+		frame->AddCulled(collector.Culled);
+	}
+
+	void Node::CollectDrawables(DrawableCollector& collector)
+	{
 		if (GetDrawable() != nullptr)
 		{
-			frame->QueueDrawable(GetDrawable());
+			collector.Drawables.push_back(GetDrawable());
 		}
 
-		// Asks children to submit their drawables to frame
-		for (auto child : mChildren)
+		for (auto& child : mChildren)
 		{
-			child->SubmitDrawables(frame);
+			child->CollectDrawables(collector);
 		}
 	}
 
@@ -20,6 +20,16 @@
 
 namespace Antomic
 {
+    // Drawables gathered from a subtree, subtrees outside the view or
+    // behind the occluders are skipped when those are given
+    struct DrawableCollector
+    {
+        const Frustum *View = nullptr;
+        const OcclusionBuffer *Occlusion = nullptr;
+        VectorRef<Drawable> Drawables;
+        uint32_t Culled = 0;
+    };
+
     enum class NodeType
     {
         SCENE,
@@ -33,7 +43,9 @@ namespace Antomic
         virtual ~Node() = default;
 
     public:
-        // Graph Operations
+        // Graph Operations. Nodes are added and removed on the main thread,
+        // those owning render resources are built on the render thread, see
+        // Application::RunOnRenderThread
         inline const VectorRef<Node> &GetChildren() const { return mChildren; }
         inline const Ref<Node> &GetParent() const { return mParent; }
         void AddChild(const Ref<Node> &node);
@@ -43,6 +55,10 @@ namespace Antomic
         // Render Operations
         virtual void SubmitDrawables(const Ref<RendererFrame> &frame);
 
+        // Appends the drawables of the subtree in submission order, only
+        // reads the graph so subtrees can be collected concurrently
+        virtual void CollectDrawables(DrawableCollector &collector);
+
         // State Operations
         virtual void Update(const uint32_t &time);
 
@@ -61,6 +77,9 @@ namespace Antomic
         inline void ClearDirty() { mDirty = false; }
         virtual void UpdateSpatialInformation() = 0;
 
+        // Called on every node of a subtree removed from its parent
+        virtual void OnRemoved();
+
     private:
         Ref<Node> mParent = nullptr;
         VectorRef<Node> mChildren;
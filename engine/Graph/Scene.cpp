@@ -14,16 +14,28 @@
    limitations under the License.
 */
 #include "Graph/Scene.h"
+#include "Graph/2D/Node2d.h"
+#include "Graph/2D/AABBTree.h"
+#include "Graph/3D/Node3d.h"
+#include "Renderer/OcclusionBuffer.h"
 #include "Renderer/Camera.h"
 #include "Renderer/RendererWorker.h"
 #include "Renderer/RendererFrame.h"
 #include "Platform/Platform.h"
+#include "Core/WorkerPool.h"
 #include "Core/Log.h"
 #include <glm/gtc/matrix_transform.hpp>
 #include "Profiling/Instrumentor.h"
 
 namespace Antomic
 {
+	// Below this many subtrees per thread it is cheaper to stay serial
+	static const uint32_t sMinSubtreesPerThread = 16;
+
+	Scene::Scene() : mIndex2d(CreateRef<AABBTree>()), mOcclusion(CreateRef<OcclusionBuffer>())
+	{
+	}
+
 	void Scene::Update(const uint32_t& time)
 	{
 		ANTOMIC_PROFILE_FUNCTION("Graph");
@@ -49,6 +61,142 @@ namespace Antomic
 		Node::Update(time);
 	}
 
+	void Scene::SubmitDrawables(const Ref<RendererFrame>& frame)
+	{
+		ANTOMIC_PROFILE_FUNCTION("Graph");
+
+		// 2D nodes are found through the index, the walk below leaves them
+		// out wherever they are in the graph
+		SubmitNodes2d(frame);
+
+		auto& children = GetChildren();
+		auto& pool = WorkerPool::Get();
+		uint32_t threads = mSubmitThreads ? mSubmitThreads : pool.GetWorkerCount() + 1;
+
+		// Occluders are rasterized before any subtree is tested against them
+		RasterizeOccluders(frame, threads);
+		auto occlusion = mOcclusion->GetOccluderCount() > 0 ? mOcclusion.get() : nullptr;
+		threads = std::max(1u, std::min(threads, (uint32_t)(children.size() / sMinSubtreesPerThread)));
+
+		// Each range of subtrees fills its own list, on the pool threads
+		mSubmitLists.resize(threads);
+		auto collect = [this, &children, &frame, occlusion, threads](uint32_t index) {
+			auto& collector = mSubmitLists[index];
+			collector.View = &frame->GetFrustum();
+			collector.Occlusion = occlusion;
+			auto begin = children.size() * index / threads;
+			auto end = children.size() * (index + 1) / threads;
+			for (auto i = begin; i < end; i++)
+			{
+				children[i]->CollectDrawables(collector);
+			}
+		};
+
+		pool.ParallelFor(threads, collect);
+
+		// Lists are merged in subtree order, the result is the same as a
+		// serial submission regardless of scheduling
+		for (auto& collector : mSubmitLists)
+		{
+			for (auto& drawable : collector.Drawables)
+			{
+				frame->QueueDrawable(drawable);
+			}
+			frame->AddCulled(collector.Culled);
+			collector.Drawables.clear();
+			collector.Culled = 0;
+		}
+	}
+
+	void Scene::SubmitNodes2d(const Ref<RendererFrame>& frame)
+	{
+		ANTOMIC_PROFILE_FUNCTION("Graph");
+
+		UpdateSubmitOrder();
+		mVisible2d.clear();
+		mIndex2d->Query(frame->GetViewRect(), [this](int32_t, void* node) {
+			mVisible2d.push_back(static_cast<Node2d*>(node));
+		});
+
+		// Sprites are queued in the order a serial walk of the graph would
+		// submit them in
+		std::sort(mVisible2d.begin(), mVisible2d.end(), [](const Node2d* a, const Node2d* b) {
+			return a->GetSubmitOrder() < b->GetSubmitOrder();
+		});
+
+		for (auto node : mVisible2d)
+		{
+			frame->QueueDrawable(node->GetDrawable());
+		}
+		frame->AddCulled(mIndex2d->GetProxyCount() - (uint32_t)mVisible2d.size());
+	}
+
+	void Scene::UpdateSubmitOrder() const
+	{
+		if (!mSubmitOrderDirty)
+		{
+			return;
+		}
+
+		ANTOMIC_PROFILE_FUNCTION("Graph");
+
+		uint64_t order = 0;
+		for (auto& child : GetChildren())
+		{
+			NumberNodes2d(*child, order);
+		}
+		mSubmitOrderDirty = false;
+	}
+
+	void Scene::NumberNodes2d(Node& node, uint64_t& order)
+	{
+		auto node2d = dynamic_cast<Node2d*>(&node);
+		if (node2d != nullptr)
+		{
+			node2d->mSubmitOrder = order++;
+		}
+
+		for (auto& child : node.GetChildren())
+		{
+			NumberNodes2d(*child, order);
+		}
+	}
+
+	void Scene::RasterizeOccluders(const Ref<RendererFrame>& frame, uint32_t threads)
+	{
+		ANTOMIC_PROFILE_FUNCTION("Graph");
+
+		mOcclusion->Begin(frame->GetProjectionMatrix() * frame->GetViewMatrix());
+		for (auto& child : GetChildren())
+		{
+			auto node = dynamic_cast<Node3d*>(child.get());
+			if (node != nullptr)
+			{
+				node->CollectOccluders(*mOcclusion);
+			}
+		}
+		mOcclusion->Rasterize(threads);
+	}
+
+	VectorRef<Node2d> Scene::QueryNodes2d(const glm::vec2& point) const
+	{
+		return QueryNodes2d(Rect(point, point));
+	}
+
+	VectorRef<Node2d> Scene::QueryNodes2d(const Rect& rect) const
+	{
+		UpdateSubmitOrder();
+		VectorRef<Node2d> nodes;
+		mIndex2d->Query(rect, [&nodes](int32_t, void* node) {
+			nodes.push_back(std::static_pointer_cast<Node2d>(static_cast<Node2d*>(node)->shared_from_this()));
+		});
+
+		std::sort(nodes.begin(), nodes.end(), [](const Ref<Node2d>& a, const Ref<Node2d>& b) {
+			return a->GetSubmitOrder() < b->GetSubmitOrder();
+		});
+		return nodes;
+	}
+
 	void Scene::Load()
 	{
 		ANTOMIC_PROFILE_FUNCTION("Graph");
@@ -16,6 +16,7 @@
 #pragma once
 #include "Core/Base.h"
 #include "Graph/Node.h"
+#include "Renderer/Bounds.h"
 #include "glm/glm.hpp"
 
 namespace Antomic
@@ -23,7 +24,7 @@ namespace Antomic
     class Scene : public Node
     {
     public:
-        Scene() = default;
+        Scene();
         virtual ~Scene() = default;
 
     public:
@@ -37,6 +38,26 @@ namespace Antomic
         void Unload();
 
         virtual void Update(const uint32_t &time) override;
+
+        // Render Operations, top level subtrees are split across threads
+        virtual void SubmitDrawables(const Ref<RendererFrame> &frame) override;
+
+        // Ranges of subtrees submitted on the worker pool, 0 uses one per
+        // pool thread and the calling one
+        inline uint32_t GetSubmitThreads() const { return mSubmitThreads; }
+        inline void SetSubmitThreads(uint32_t threads) { mSubmitThreads = threads; }
+
+        // Spatial index of the 2D nodes, the renderer queries it with the
+        // view rectangle so sprites outside the view are never submitted
+        inline const Ref<AABBTree> &GetSpatialIndex2d() const { return mIndex2d; }
+
+        // Picking, 2D nodes covering the point or overlapping the rect
+        VectorRef<Node2d> QueryNodes2d(const glm::vec2 &point) const;
+        VectorRef<Node2d> QueryNodes2d(const Rect &rect) const;
+
+        // Depth buffer the occluders of the 3D nodes are rasterized into
+        inline const Ref<OcclusionBuffer> &GetOcclusionBuffer() const { return mOcclusion; }
+
         // Serialization
         virtual void Serialize(nlohmann::json &json) override;
         static Ref<Scene> Deserialize(const nlohmann::json &json);
@@ -45,9 +66,25 @@ namespace Antomic
         virtual const Ref<Drawable> GetDrawable() const override { return nullptr; }
     virtual void UpdateSpatialInformation() override {}
 
+    private:
+        // Nodes registering with the index change the graph order
+        friend class Node2d;
+        inline void InvalidateSubmitOrder() { mSubmitOrderDirty = true; }
+        void UpdateSubmitOrder() const;
+        static void NumberNodes2d(Node &node, uint64_t &order);
+
+        void SubmitNodes2d(const Ref<RendererFrame> &frame);
+        void RasterizeOccluders(const Ref<RendererFrame> &frame, uint32_t threads);
+
     private:
         glm::mat4 mViewMatrix;
         Ref<Camera> mActiveCamera;
+        uint32_t mSubmitThreads = 0;
+        std::vector<DrawableCollector> mSubmitLists;
+        Ref<AABBTree> mIndex2d;
+        std::vector<Node2d *> mVisible2d;
+        mutable bool mSubmitOrderDirty = false;
+        Ref<OcclusionBuffer> mOcclusion;
     };
 
 } // namespace Antomic
@@ -186,6 +186,16 @@ namespace Antomic
         glfwSwapBuffers(mWindow);
     }
 
+    void GLFWWindow::MakeContextCurrent(bool current)
+    {
+        glfwMakeContextCurrent(current ? mWindow : nullptr);
+    }
+
+    bool GLFWWindow::IsContextCurrent() const
+    {
+        return glfwGetCurrentContext() == mWindow;
+    }
+
     void GLFWWindow::ProcessEvents()
     {
         glfwPollEvents();
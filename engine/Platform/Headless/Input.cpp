@@ -0,0 +1,45 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "Platform/Headless/Input.h"
+#include "Platform/Headless/Window.h"
+#include "Platform/Platform.h"
+
+namespace Antomic
+{
+    bool InputHeadless::IsKeyPressed(Key::Enum key)
+    {
+        auto *window = static_cast<HeadlessWindow *>(Platform::GetWindow().get());
+        return window->IsKeyPressed(key);
+    }
+
+    bool InputHeadless::IsMouseButtonPressed(MouseButton::Enum button)
+    {
+        auto *window = static_cast<HeadlessWindow *>(Platform::GetWindow().get());
+        return window->IsMouseButtonPressed(button);
+    }
+
+    uint8_t InputHeadless::GetKeyModifiers()
+    {
+        return 0;
+    }
+
+    glm::vec3 InputHeadless::GetMousePosition()
+    {
+        auto *window = static_cast<HeadlessWindow *>(Platform::GetWindow().get());
+        return window->GetMousePosition();
+    }
+
+} // namespace Antomic
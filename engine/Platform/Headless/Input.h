@@ -0,0 +1,35 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+#include "Platform/Input.h"
+
+namespace Antomic
+{
+    // Reads the state left by the events played on the headless window
+    class InputHeadless : public Input
+    {
+    public:
+        InputHeadless() = default;
+        virtual ~InputHeadless() override = default;
+
+    public:
+        virtual bool IsKeyPressed(Key::Enum key) override;
+        virtual bool IsMouseButtonPressed(MouseButton::Enum button) override;
+        virtual uint8_t GetKeyModifiers() override;
+        virtual glm::vec3 GetMousePosition() override;
+    };
+
+} // namespace Antomic
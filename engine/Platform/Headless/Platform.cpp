@@ -0,0 +1,51 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "Platform/Headless/Platform.h"
+#include "Platform/Headless/Input.h"
+
+namespace Antomic
+{
+    HeadlessPlatform::HeadlessPlatform(const HeadlessSettings &settings)
+        : mSettings(settings)
+    {
+        mPlatformStart = std::chrono::steady_clock::now();
+    }
+
+    Scope<Window> HeadlessPlatform::CreateWindow(uint32_t width, uint32_t height, std::string title, RenderAPIDialect api)
+    {
+        return CreateScope<HeadlessWindow>(width, height, title, mSettings.Script);
+    }
+
+    Scope<Input> HeadlessPlatform::CreateInput()
+    {
+        return CreateScope<InputHeadless>();
+    }
+
+    uint64_t HeadlessPlatform::GetTicks() const
+    {
+        // Every run sees the same time steps, whatever the machine
+        if (mSettings.FrameTime > 0)
+        {
+            auto *window = static_cast<HeadlessWindow *>(Platform::GetWindow().get());
+            return window->GetFrame() * mSettings.FrameTime;
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(now - mPlatformStart);
+        return milliseconds.count();
+    }
+
+} // namespace Antomic
@@ -0,0 +1,48 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+#include "Platform/Platform.h"
+#include "Platform/Headless/Window.h"
+
+namespace Antomic
+{
+    struct HeadlessSettings
+    {
+        // Milliseconds each frame moves the clock, zero follows the real clock
+        uint64_t FrameTime = 16;
+        std::vector<HeadlessEvent> Script;
+    };
+
+    // Runs without a display, paired with the null render API
+    class HeadlessPlatform : public Platform
+    {
+    public:
+        HeadlessPlatform(const HeadlessSettings &settings);
+        virtual ~HeadlessPlatform() override = default;
+
+    public:
+        // Windows Operations
+        virtual Scope<Window> CreateWindow(uint32_t width, uint32_t height, std::string title, RenderAPIDialect api = RenderAPIDialect::NONE) override;
+        virtual Scope<Input> CreateInput() override;
+
+        // Time Operations
+        virtual uint64_t GetTicks() const override;
+
+    private:
+        HeadlessSettings mSettings;
+        std::chrono::time_point<std::chrono::steady_clock> mPlatformStart;
+    };
+} // namespace Antomic
@@ -0,0 +1,109 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "Platform/Headless/Window.h"
+#include "Events/WindowEvent.h"
+#include "Events/KeyEvent.h"
+#include "Events/MouseEvent.h"
+
+namespace Antomic
+{
+    HeadlessWindow::HeadlessWindow(uint32_t width, uint32_t height, std::string title, const std::vector<HeadlessEvent> &script)
+        : mScript(script)
+    {
+        mData.Title = title;
+        mData.Width = width;
+        mData.Height = height;
+        mData.VSync = false;
+
+        // Events on the same frame are played in the order given
+        std::stable_sort(mScript.begin(), mScript.end(), [](const HeadlessEvent &a, const HeadlessEvent &b) {
+            return a.Frame < b.Frame;
+        });
+    }
+
+    void HeadlessWindow::ProcessEvents()
+    {
+        while (mNextEvent < mScript.size() && mScript[mNextEvent].Frame <= mFrame)
+        {
+            Dispatch(mScript[mNextEvent++]);
+        }
+        mFrame++;
+    }
+
+    void HeadlessWindow::Dispatch(const HeadlessEvent &event)
+    {
+        switch (event.Type)
+        {
+        case HeadlessEventType::KeyPressed:
+        {
+            mKeys[event.KeyCode] = true;
+            KeyPressedEvent keyEvent(event.KeyCode, 0, 0);
+            if (mData.Handler)
+                mData.Handler(keyEvent);
+            break;
+        }
+        case HeadlessEventType::KeyReleased:
+        {
+            mKeys[event.KeyCode] = false;
+            KeyReleasedEvent keyEvent(event.KeyCode, 0);
+            if (mData.Handler)
+                mData.Handler(keyEvent);
+            break;
+        }
+        case HeadlessEventType::MouseMoved:
+        {
+            mMousePosition = glm::vec3(event.X, event.Y, 0.0f);
+            MouseMovedEvent mouseEvent(event.X, event.Y);
+            if (mData.Handler)
+                mData.Handler(mouseEvent);
+            break;
+        }
+        case HeadlessEventType::MouseButtonPressed:
+        {
+            mButtons[event.Button] = true;
+            MouseButtonPressedEvent mouseEvent(event.Button);
+            if (mData.Handler)
+                mData.Handler(mouseEvent);
+            break;
+        }
+        case HeadlessEventType::MouseButtonReleased:
+        {
+            mButtons[event.Button] = false;
+            MouseButtonReleasedEvent mouseEvent(event.Button);
+            if (mData.Handler)
+                mData.Handler(mouseEvent);
+            break;
+        }
+        case HeadlessEventType::Resize:
+        {
+            mData.Width = (uint32_t)event.X;
+            mData.Height = (uint32_t)event.Y;
+            WindowResizeEvent windowEvent(mData.Width, mData.Height);
+            if (mData.Handler)
+                mData.Handler(windowEvent);
+            break;
+        }
+        case HeadlessEventType::Close:
+        {
+            WindowCloseEvent windowEvent;
+            if (mData.Handler)
+                mData.Handler(windowEvent);
+            break;
+        }
+        }
+    }
+
+} // namespace Antomic
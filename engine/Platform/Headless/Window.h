@@ -0,0 +1,89 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+#include "Platform/Window.h"
+#include "Platform/Input.h"
+
+namespace Antomic
+{
+    enum class HeadlessEventType
+    {
+        KeyPressed = 0,
+        KeyReleased,
+        MouseMoved,
+        MouseButtonPressed,
+        MouseButtonReleased,
+        Resize,
+        Close
+    };
+
+    // Input played back by the headless window on the given frame
+    struct HeadlessEvent
+    {
+        uint64_t Frame = 0;
+        HeadlessEventType Type = HeadlessEventType::Close;
+        Key::Enum KeyCode = Key::None;
+        MouseButton::Enum Button = MouseButton::None;
+
+        // Mouse position, or the new size on resize
+        float X = 0.0f, Y = 0.0f;
+    };
+
+    class HeadlessWindow : public Window
+    {
+    public:
+        HeadlessWindow(uint32_t width, uint32_t height, std::string title, const std::vector<HeadlessEvent> &script = {});
+        virtual ~HeadlessWindow() override = default;
+
+    public:
+        virtual uint32_t GetWidth() const override { return mData.Width; };
+        virtual uint32_t GetHeight() const override { return mData.Height; };
+        virtual const std::string &GetTitle() const override { return mData.Title; };
+        virtual void SetTitle(const std::string &title) override { mData.Title = title; }
+        virtual bool IsValid() const override { return true; };
+        virtual void SetEventHandler(const EventHandler &handler) override { mData.Handler = handler; }
+        virtual void SwapBuffer() override {}
+        virtual void MakeContextCurrent(bool current) override {}
+        virtual bool IsContextCurrent() const override { return true; }
+        virtual void ProcessEvents() override;
+        virtual void ToggleFullscreen() override {}
+        virtual void SetMouseLock(bool lock) override {}
+        virtual void *GetNativeWindow() const override { return nullptr; }
+        virtual void Close() override {}
+
+    public:
+        // Number of times events were processed, one per application frame
+        inline uint64_t GetFrame() const { return mFrame; }
+
+        inline bool IsKeyPressed(Key::Enum key) const { return mKeys[key]; }
+        inline bool IsMouseButtonPressed(MouseButton::Enum button) const { return mButtons[button]; }
+        inline const glm::vec3 &GetMousePosition() const { return mMousePosition; }
+
+    private:
+        void Dispatch(const HeadlessEvent &event);
+
+    private:
+        WindowData mData;
+        std::vector<HeadlessEvent> mScript;
+        size_t mNextEvent = 0;
+        uint64_t mFrame = 0;
+
+        bool mKeys[Key::Count] = {};
+        bool mButtons[MouseButton::Count] = {};
+        glm::vec3 mMousePosition = glm::vec3(0.0f);
+    };
+
+} // namespace Antomic
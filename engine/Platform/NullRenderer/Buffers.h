@@ -26,7 +26,7 @@ namespace Antomic
     class NullIndexBuffer : public IndexBuffer
     {
     public:
-        NullIndexBuffer(uint32_t *data, uint32_t size) : mCount(size / sizeof(uint32_t)) {}
+        NullIndexBuffer(const void *data, uint32_t size, IndexType type) : IndexBuffer(type, size / IndexTypeSize(type)) {}
         virtual ~NullIndexBuffer() override {}
 
     public:
@@ -34,12 +34,9 @@ namespace Antomic
         virtual void Bind() const override {}
         virtual void Unbind() const override {}
 
+    protected:
         // IndexBuffer operations
-        virtual void Upload(uint32_t *data, uint32_t size) const override {}
-        virtual uint32_t Count() const override { return mCount; };
-
-    private:
-        uint32_t mCount;
+        virtual void SetData(const void *data, uint32_t size) const override {}
     };
 
     /*************************************************************
@@ -49,7 +46,8 @@ namespace Antomic
     class NullVertexBuffer : public VertexBuffer
     {
     public:
-        NullVertexBuffer(float *data, uint32_t size) {}
+        NullVertexBuffer(const void *data, uint32_t size) {}
+        NullVertexBuffer(uint32_t size) {}
         virtual ~NullVertexBuffer() override{};
 
     public:
@@ -59,6 +57,7 @@ namespace Antomic
 
         // VertexBuffer commands
         virtual void Upload(uint32_t *data, uint32_t size) const override {}
+        virtual void SetData(const void *data, uint32_t size) override {}
         virtual const BufferLayout &Layout() const { return mLayout; }
         virtual void SetLayout(const BufferLayout &layout) override { mLayout = layout; }
 
@@ -73,24 +72,12 @@ namespace Antomic
     class NullUniformBuffer : public UniformBuffer
     {
     public:
-        NullUniformBuffer(const UniformBufferLayout &layout, uint32_t binding) {}
+        NullUniformBuffer(const UniformBufferLayout &layout, uint32_t binding) : UniformBuffer(layout) {}
         virtual ~NullUniformBuffer() override{};
 
-    public:
+    protected:
         // Uniform Buffer commands
-        virtual void SetValue(const std::string &name, const glm::mat4 &data) override {}
-        virtual void SetValue(const std::string &name, const glm::mat3 &data) override {}
-        virtual void SetValue(const std::string &name, const glm::vec4 &data) override {}
-        virtual void SetValue(const std::string &name, const glm::vec3 &data) override {}
-        virtual void SetValue(const std::string &name, const glm::vec2 &data) override {}
-        virtual void SetValue(const std::string &name, float data) override {}
-        virtual void SetValue(const std::string &name, uint32_t data) override {}
-        virtual void SetValue(const std::string &name, int data) override {}
-        virtual void SetValue(const std::string &name, bool data) override {}
-        virtual const UniformBufferLayout &Layout() const override { return mLayout; }
-
-    private:
-        UniformBufferLayout mLayout;
+        virtual void Upload(uint32_t offset, uint32_t size, const void *data) override {}
     };
 
 } // namespace Antomic
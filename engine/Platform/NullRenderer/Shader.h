@@ -30,6 +30,17 @@ namespace Antomic
         virtual void Bind() const override {}
         virtual void Unbind() const override {}
 
+        // Uniform reflection
+        virtual const ShaderUniform *GetUniform(const std::string &name) const override { return nullptr; }
+
+        // Typed Uniform Commands
+        virtual void SetUniformValue(UniformHandle<float> handle, float value) override {}
+        virtual void SetUniformValue(UniformHandle<glm::vec2> handle, const glm::vec2 &value) override {}
+        virtual void SetUniformValue(UniformHandle<glm::vec3> handle, const glm::vec3 &value) override {}
+        virtual void SetUniformValue(UniformHandle<glm::vec4> handle, const glm::vec4 &value) override {}
+        virtual void SetUniformValue(UniformHandle<glm::mat3> handle, const glm::mat3 &value) override {}
+        virtual void SetUniformValue(UniformHandle<glm::mat4> handle, const glm::mat4 &value) override {}
+
         // Uniform Commands
         virtual void SetUniformValue(const std::string& name, float value) override {}
         virtual void SetUniformValue(const std::string& name, const glm::vec2 &value) override {}
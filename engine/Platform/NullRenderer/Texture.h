@@ -22,13 +22,19 @@ namespace Antomic
     class NullTexture : public Texture
     {
     public:
-        NullTexture(uint32_t width, uint32_t height, unsigned char* data) {};
+        NullTexture(const TextureSpecification &specification, unsigned char *data) : Texture(specification) {};
         virtual ~NullTexture() = default;
 
     public:
         // Bind/Unbind commands
         virtual void Bind() const override {};
+        virtual void Bind(uint32_t slot) const override {};
         virtual void Unbind() const override {};
+
+        // Texture commands
+        virtual void SetData(uint32_t x, uint32_t y, uint32_t width, uint32_t height, unsigned char *data) override {};
+        virtual void SetData(uint32_t x, uint32_t y, uint32_t width, uint32_t height, const StreamBuffer &staging, uint32_t offset) override {};
+        virtual void SetCompressedData(uint32_t level, const unsigned char *data, uint32_t size) override {};
     };
     
 } // namespace Antomic
@@ -32,10 +32,13 @@ namespace Antomic {
         virtual void SetIndexBuffer(const Ref<IndexBuffer> &buffer) override { mIndexBuffer = buffer; }
         virtual const std::vector<Ref<VertexBuffer>> &GetVertexBuffers() const override { return mVertextBuffers; };
         virtual const Ref<IndexBuffer> &GetIndexBuffer() const override { return mIndexBuffer; };
+        virtual void SetInstanceBuffer(const Ref<VertexBuffer> &buffer) override { mInstanceBuffer = buffer; }
+        virtual const Ref<VertexBuffer> &GetInstanceBuffer() const override { return mInstanceBuffer; };
         
     private:
         std::vector<Ref<VertexBuffer>> mVertextBuffers;
         Ref<IndexBuffer> mIndexBuffer;
+        Ref<VertexBuffer> mInstanceBuffer;
     };
 
 }
\ No newline at end of file
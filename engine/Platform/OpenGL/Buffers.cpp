@@ -14,80 +14,107 @@
    limitations under the License.
 */
 #include "Platform/OpenGL/Buffers.h"
+#include "Platform/OpenGL/State.h"
 #include "Platform/OpenGL/Shader.h"
+#include "Platform/Platform.h"
 #include "glad/glad.h"
 #include <glm/gtc/type_ptr.hpp>
 
 namespace Antomic
 {
 
+    GLenum IndexTypeGLEnum(IndexType t)
+    {
+        return t == IndexType::UInt16 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+    }
+
     /*************************************************************
      * OpenGLIndexBuffer Implementation
      *************************************************************/
 
-    OpenGLIndexBuffer::OpenGLIndexBuffer(uint32_t *data, uint32_t size)
+    OpenGLIndexBuffer::OpenGLIndexBuffer(const void *data, uint32_t size, IndexType type)
+        : IndexBuffer(type, size / IndexTypeSize(type))
     {
+        ANTOMIC_ASSERT(Platform::IsContextCurrent(), "OpenGLIndexBuffer: Created without the render context, use Application::RunOnRenderThread");
         glCreateBuffers(1, &mRendererId);
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mRendererId);
+        OpenGLState::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, mRendererId);
         glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, data, GL_STATIC_DRAW);
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-        mCount = size / sizeof(uint32_t);
+        OpenGLState::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
     }
 
     OpenGLIndexBuffer::~OpenGLIndexBuffer()
     {
-        glDeleteBuffers(1, &mRendererId);
+        OpenGLState::Delete([id = mRendererId]() {
+            OpenGLState::ReleaseBuffer(id);
+            glDeleteBuffers(1, &id);
+        });
     }
 
     void OpenGLIndexBuffer::Bind() const
     {
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mRendererId);
+        OpenGLState::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, mRendererId);
     }
 
     void OpenGLIndexBuffer::Unbind() const
     {
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+        OpenGLState::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
     }
 
-    void OpenGLIndexBuffer::Upload(uint32_t *data, uint32_t size) const
+    void OpenGLIndexBuffer::SetData(const void *data, uint32_t size) const
     {
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mRendererId);
+        OpenGLState::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, mRendererId);
         glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, data, GL_STATIC_DRAW);
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+        OpenGLState::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
     }
 
     /*************************************************************
      * OpenGLVertexBuffer Implementation
      *************************************************************/
 
-    OpenGLVertexBuffer::OpenGLVertexBuffer(float *data, uint32_t size)
+    OpenGLVertexBuffer::OpenGLVertexBuffer(const void *data, uint32_t size)
     {
+        ANTOMIC_ASSERT(Platform::IsContextCurrent(), "OpenGLVertexBuffer: Created without the render context, use Application::RunOnRenderThread");
         glCreateBuffers(1, &mRendererId);
-        glBindBuffer(GL_ARRAY_BUFFER, mRendererId);
+        OpenGLState::BindBuffer(GL_ARRAY_BUFFER, mRendererId);
         glBufferData(GL_ARRAY_BUFFER, size, data, GL_STATIC_DRAW);
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        OpenGLState::BindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    OpenGLVertexBuffer::OpenGLVertexBuffer(uint32_t size)
+    {
+        ANTOMIC_ASSERT(Platform::IsContextCurrent(), "OpenGLVertexBuffer: Created without the render context, use Application::RunOnRenderThread");
+        glCreateBuffers(1, &mRendererId);
+        glNamedBufferData(mRendererId, size, nullptr, GL_DYNAMIC_DRAW);
     }
 
     OpenGLVertexBuffer::~OpenGLVertexBuffer()
     {
-        glDeleteBuffers(1, &mRendererId);
+        OpenGLState::Delete([id = mRendererId]() {
+            OpenGLState::ReleaseBuffer(id);
+            glDeleteBuffers(1, &id);
+        });
     }
 
     void OpenGLVertexBuffer::Bind() const
     {
-        glBindBuffer(GL_ARRAY_BUFFER, mRendererId);
+        OpenGLState::BindBuffer(GL_ARRAY_BUFFER, mRendererId);
     }
 
     void OpenGLVertexBuffer::Unbind() const
     {
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        OpenGLState::BindBuffer(GL_ARRAY_BUFFER, 0);
     }
 
     void OpenGLVertexBuffer::Upload(uint32_t *data, uint32_t size) const
     {
-        glBindBuffer(GL_ARRAY_BUFFER, mRendererId);
+        OpenGLState::BindBuffer(GL_ARRAY_BUFFER, mRendererId);
         glBufferData(GL_ARRAY_BUFFER, size, data, GL_STATIC_DRAW);
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        OpenGLState::BindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    void OpenGLVertexBuffer::SetData(const void *data, uint32_t size)
+    {
+        glNamedBufferSubData(mRendererId, 0, size, data);
     }
 
     void OpenGLVertexBuffer::SetLayout(const BufferLayout &layout)
@@ -100,69 +127,24 @@ namespace Antomic
      *************************************************************/
 
     OpenGLUniformBuffer::OpenGLUniformBuffer(const UniformBufferLayout &layout, uint32_t binding)
+        : UniformBuffer(layout)
     {
-        mLayout = layout;
+        ANTOMIC_ASSERT(Platform::IsContextCurrent(), "OpenGLUniformBuffer: Created without the render context, use Application::RunOnRenderThread");
         glCreateBuffers(1, &mRendererId);
-        glNamedBufferData(mRendererId, mLayout.Stride(), nullptr, GL_DYNAMIC_DRAW); // TODO: investigate usage hint
-        glBindBufferBase(GL_UNIFORM_BUFFER, binding, mRendererId);
+        glNamedBufferData(mRendererId, layout.Stride(), nullptr, GL_DYNAMIC_DRAW); // TODO: investigate usage hint
+        OpenGLState::BindBufferBase(GL_UNIFORM_BUFFER, binding, mRendererId);
     }
 
     OpenGLUniformBuffer::~OpenGLUniformBuffer()
     {
-        glDeleteBuffers(1, &mRendererId);
-    }
-
-    void OpenGLUniformBuffer::SetValue(const std::string &name, const glm::mat4 &data)
-    {
-        auto element = mLayout.GetElement(name);
-        glNamedBufferSubData(mRendererId, element.Offset, sizeof(glm::mat4), glm::value_ptr(data));
-    }
-
-    void OpenGLUniformBuffer::SetValue(const std::string &name, const glm::mat3 &data)
-    {
-        auto element = mLayout.GetElement(name);
-        glNamedBufferSubData(mRendererId, element.Offset, sizeof(glm::mat4), glm::value_ptr(glm::mat4(data)));
-    }
-
-    void OpenGLUniformBuffer::SetValue(const std::string &name, const glm::vec4 &data)
-    {
-        auto element = mLayout.GetElement(name);
-        glNamedBufferSubData(mRendererId, element.Offset, sizeof(glm::vec4), glm::value_ptr(data));
-    }
-
-    void OpenGLUniformBuffer::SetValue(const std::string &name, const glm::vec3 &data)
-    {
-        auto element = mLayout.GetElement(name);
-        glNamedBufferSubData(mRendererId, element.Offset, sizeof(glm::vec4), glm::value_ptr(glm::vec4(data, 0.0f)));
-    }
-
-    void OpenGLUniformBuffer::SetValue(const std::string &name, const glm::vec2 &data)
-    {
-        auto element = mLayout.GetElement(name);
-        glNamedBufferSubData(mRendererId, element.Offset, sizeof(glm::vec2), glm::value_ptr(data));
-    }
-
-    void OpenGLUniformBuffer::SetValue(const std::string &name, float data)
-    {
-        auto element = mLayout.GetElement(name);
-        glNamedBufferSubData(mRendererId, element.Offset, sizeof(float), &data);
-    }
-
-    void OpenGLUniformBuffer::SetValue(const std::string &name, uint32_t data)
-    {
-        auto element = mLayout.GetElement(name);
-        glNamedBufferSubData(mRendererId, element.Offset, sizeof(uint32_t), &data);
-    }
-
-    void OpenGLUniformBuffer::SetValue(const std::string &name, int data)
-    {
-        auto element = mLayout.GetElement(name);
-        glNamedBufferSubData(mRendererId, element.Offset, sizeof(int), &data);
+        OpenGLState::Delete([id = mRendererId]() {
+            OpenGLState::ReleaseBuffer(id);
+            glDeleteBuffers(1, &id);
+        });
     }
 
-    void OpenGLUniformBuffer::SetValue(const std::string &name, bool data)
+    void OpenGLUniformBuffer::Upload(uint32_t offset, uint32_t size, const void *data)
     {
-        auto element = mLayout.GetElement(name);
-        glNamedBufferSubData(mRendererId, element.Offset, sizeof(bool), &data);
+        glNamedBufferSubData(mRendererId, offset, size, data);
     }
 }
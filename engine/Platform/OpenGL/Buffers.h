@@ -19,6 +19,8 @@
 
 namespace Antomic
 {
+    GLenum IndexTypeGLEnum(IndexType t);
+
     /*************************************************************
      * OpenGLIndexBuffer Implementation
      *************************************************************/
@@ -26,21 +28,20 @@ namespace Antomic
     class OpenGLIndexBuffer : public IndexBuffer
     {
     public:
-        OpenGLIndexBuffer(uint32_t *data, uint32_t size);
+        OpenGLIndexBuffer(const void *data, uint32_t size, IndexType type);
         virtual ~OpenGLIndexBuffer() override;
 
     public:
         // Bind/Unbind commands
         virtual void Bind() const override;
         virtual void Unbind() const override;
-        
+
+    protected:
         // IndexBuffer commands
-        virtual void Upload(uint32_t *data, uint32_t size) const override;
-        virtual uint32_t Count() const override { return mCount; };
+        virtual void SetData(const void *data, uint32_t size) const override;
 
     private:
         GLuint mRendererId;
-        uint32_t mCount;
     };
 
     /*************************************************************
@@ -50,7 +51,8 @@ namespace Antomic
     class OpenGLVertexBuffer : public VertexBuffer
     {
     public:
-        OpenGLVertexBuffer(float *data, uint32_t size);
+        OpenGLVertexBuffer(const void *data, uint32_t size);
+        OpenGLVertexBuffer(uint32_t size);
         virtual ~OpenGLVertexBuffer() override;
 
     public:
@@ -60,8 +62,10 @@ namespace Antomic
         
         // VertexBuffer commands
         virtual void Upload(uint32_t *data, uint32_t size) const override;
+        virtual void SetData(const void *data, uint32_t size) override;
         virtual const BufferLayout &Layout() const { return mLayout; };
         virtual void SetLayout(const BufferLayout &layout) override;
+        inline GLuint GetRendererId() const { return mRendererId; }
 
     private:
         GLuint mRendererId;
@@ -78,22 +82,12 @@ namespace Antomic
         OpenGLUniformBuffer(const UniformBufferLayout &layout, uint32_t binding);
         virtual ~OpenGLUniformBuffer() override;
 
-    public:
+    protected:
         // UniformBuffer commands
-        virtual void SetValue(const std::string &name, const glm::mat4 &data) override;
-        virtual void SetValue(const std::string &name, const glm::mat3 &data) override;
-        virtual void SetValue(const std::string &name, const glm::vec4 &data) override;
-        virtual void SetValue(const std::string &name, const glm::vec3 &data) override;
-        virtual void SetValue(const std::string &name, const glm::vec2 &data) override;
-        virtual void SetValue(const std::string &name, float data ) override;
-        virtual void SetValue(const std::string &name, uint32_t data) override;
-        virtual void SetValue(const std::string &name, int data) override;
-        virtual void SetValue(const std::string &name, bool data) override;
-        virtual const UniformBufferLayout &Layout() const override { return mLayout; }
+        virtual void Upload(uint32_t offset, uint32_t size, const void *data) override;
 
     private:
         GLuint mRendererId;
-        UniformBufferLayout mLayout;
     };
 
 
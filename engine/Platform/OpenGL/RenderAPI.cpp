@@ -14,18 +14,24 @@
    limitations under the License.
 */
 #include "Platform/OpenGL/RenderAPI.h"
+#include "Platform/OpenGL/State.h"
+#include "Platform/OpenGL/Buffers.h"
+#include "Platform/OpenGL/Shader.h"
+#include "Platform/OpenGL/Texture.h"
+#include "Platform/OpenGL/VertexArray.h"
+#include "Renderer/CommandBuffer.h"
 #include "glad/glad.h"
 
 namespace Antomic
 {
     void OpenGLRenderAPI::SetViewport(const uint32_t &x, const uint32_t &y, uint32_t const &width, uint32_t const &height)
     {
-        glViewport(x, y, width, height);
+        OpenGLState::SetViewport(x, y, width, height);
     }
 
     void OpenGLRenderAPI::SetClearColor(glm::vec4 color)
     {
-        glClearColor(color.r, color.g, color.b, color.a);
+        OpenGLState::SetClearColor(color);
     }
 
     void OpenGLRenderAPI::Clear()
@@ -33,10 +39,127 @@ namespace Antomic
         glClear(GL_COLOR_BUFFER_BIT);
     }
 
-    void OpenGLRenderAPI::DrawIndexed(const Ref<VertexArray> vertexArray)
+    void OpenGLRenderAPI::DrawIndexed(const Ref<VertexArray> vertexArray, uint32_t indexCount, uint32_t baseVertex)
     {
+        uint32_t count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->Count();
+        auto type = IndexTypeGLEnum(vertexArray->GetIndexBuffer()->Type());
         vertexArray->Bind();
-        glDrawElements(GL_TRIANGLES, vertexArray->GetIndexBuffer()->Count(), GL_UNSIGNED_INT, nullptr);
+        if (baseVertex == 0)
+        {
+            glDrawElements(GL_TRIANGLES, count, type, nullptr);
+            return;
+        }
+        glDrawElementsBaseVertex(GL_TRIANGLES, count, type, nullptr, baseVertex);
     }
 
-} // namespace Antomic
\ No newline at end of file
+    void OpenGLRenderAPI::DrawIndexedInstanced(const Ref<VertexArray> vertexArray, uint32_t instanceCount, uint32_t indexCount)
+    {
+        uint32_t count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->Count();
+        auto type = IndexTypeGLEnum(vertexArray->GetIndexBuffer()->Type());
+        vertexArray->Bind();
+        glDrawElementsInstanced(GL_TRIANGLES, count, type, nullptr, instanceCount);
+    }
+
+    static void SetUniform(const RenderCommands::SetUniform &command, const void *data)
+    {
+        auto program = static_cast<const OpenGLShader *>(command.Program)->GetRendererId();
+        auto value = static_cast<const GLfloat *>(data);
+        switch (command.DataType)
+        {
+        case ShaderDataType::Float:
+            glProgramUniform1fv(program, command.Location, 1, value);
+            return;
+        case ShaderDataType::Vec2:
+            glProgramUniform2fv(program, command.Location, 1, value);
+            return;
+        case ShaderDataType::Vec3:
+            glProgramUniform3fv(program, command.Location, 1, value);
+            return;
+        case ShaderDataType::Vec4:
+            glProgramUniform4fv(program, command.Location, 1, value);
+            return;
+        case ShaderDataType::Mat3:
+            glProgramUniformMatrix3fv(program, command.Location, 1, GL_FALSE, value);
+            return;
+        case ShaderDataType::Mat4:
+            glProgramUniformMatrix4fv(program, command.Location, 1, GL_FALSE, value);
+            return;
+        default:
+            return;
+        }
+    }
+
+    void OpenGLRenderAPI::Execute(const CommandBuffer &commands)
+    {
+        // Packets are decoded here, resources are downcast to the OpenGL
+        // objects so no virtual call is made per command
+        for (auto header = commands.Begin(); header != commands.End(); header = CommandBuffer::Next(header))
+        {
+            switch (header->Type)
+            {
+            case RenderCommandType::SET_VIEWPORT:
+            {
+                auto &command = CommandBuffer::GetCommand<RenderCommands::SetViewport>(header);
+                OpenGLState::SetViewport(command.X, command.Y, command.Width, command.Height);
+                break;
+            }
+            case RenderCommandType::SET_CLEAR_COLOR:
+                OpenGLState::SetClearColor(CommandBuffer::GetCommand<RenderCommands::SetClearColor>(header).Color);
+                break;
+            case RenderCommandType::CLEAR:
+                glClear(GL_COLOR_BUFFER_BIT);
+                break;
+            case RenderCommandType::BIND_SHADER:
+            {
+                auto &command = CommandBuffer::GetCommand<RenderCommands::BindShader>(header);
+                OpenGLState::UseProgram(static_cast<const OpenGLShader *>(command.Program)->GetRendererId());
+                break;
+            }
+            case RenderCommandType::BIND_TEXTURE:
+            {
+                auto &command = CommandBuffer::GetCommand<RenderCommands::BindTexture>(header);
+                OpenGLState::BindTextureUnit(command.Slot, static_cast<const OpenGLTexture *>(command.Image)->GetRendererId());
+                break;
+            }
+            case RenderCommandType::SET_UNIFORM:
+            {
+                auto &command = CommandBuffer::GetCommand<RenderCommands::SetUniform>(header);
+                SetUniform(command, CommandBuffer::GetPayload(&command));
+                break;
+            }
+            case RenderCommandType::UPDATE_BUFFER:
+            {
+                auto &command = CommandBuffer::GetCommand<RenderCommands::UpdateBuffer>(header);
+                auto buffer = static_cast<const OpenGLVertexBuffer *>(command.Buffer)->GetRendererId();
+                glNamedBufferSubData(buffer, command.Offset, command.DataSize, CommandBuffer::GetPayload(&command));
+                break;
+            }
+            case RenderCommandType::DRAW_INDEXED:
+            {
+                auto &command = CommandBuffer::GetCommand<RenderCommands::DrawIndexed>(header);
+                OpenGLState::BindVertexArray(static_cast<const OpenGLVertexArray *>(command.Vertices)->GetRendererId());
+                if (command.BaseVertex == 0)
+                {
+                    glDrawElements(GL_TRIANGLES, command.IndexCount, IndexTypeGLEnum(command.Indices), nullptr);
+                    break;
+                }
+                glDrawElementsBaseVertex(GL_TRIANGLES, command.IndexCount, IndexTypeGLEnum(command.Indices), nullptr, command.BaseVertex);
+                break;
+            }
+            case RenderCommandType::DRAW_INDEXED_INSTANCED:
+            {
+                auto &command = CommandBuffer::GetCommand<RenderCommands::DrawIndexedInstanced>(header);
+                OpenGLState::BindVertexArray(static_cast<const OpenGLVertexArray *>(command.Vertices)->GetRendererId());
+                glDrawElementsInstanced(GL_TRIANGLES, command.IndexCount, IndexTypeGLEnum(command.Indices), nullptr, command.InstanceCount);
+                break;
+            }
+            }
+        }
+    }
+
+    void OpenGLRenderAPI::CollectReleased()
+    {
+        OpenGLState::CollectReleased();
+    }
+
+} // namespace Antomic
@@ -28,6 +28,9 @@ namespace Antomic
         virtual void SetViewport(const uint32_t &x, const uint32_t &y, uint32_t const &width, uint32_t const &height) override;
         virtual void SetClearColor(glm::vec4 color) override;
         virtual void Clear() override;
-        virtual void DrawIndexed(const Ref<VertexArray> vertexArray) override;
+        virtual void DrawIndexed(const Ref<VertexArray> vertexArray, uint32_t indexCount = 0, uint32_t baseVertex = 0) override;
+        virtual void DrawIndexedInstanced(const Ref<VertexArray> vertexArray, uint32_t instanceCount, uint32_t indexCount = 0) override;
+        virtual void Execute(const CommandBuffer &commands) override;
+        virtual void CollectReleased() override;
     };
 } // namespace Antomic
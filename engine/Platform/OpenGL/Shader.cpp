@@ -14,6 +14,9 @@
    limitations under the License.
 */
 #include "Platform/OpenGL/Shader.h"
+#include "Platform/OpenGL/State.h"
+#include "Platform/Platform.h"
+#include "Renderer/ShaderCache.h"
 #include "Core/Log.h"
 #include <glad/glad.h>
 #include <glm/gtc/type_ptr.hpp>
@@ -38,6 +41,18 @@ namespace Antomic
             return GL_INT;
         case ShaderDataType::Bool:
             return GL_UNSIGNED_SHORT;
+        case ShaderDataType::Half2:
+        case ShaderDataType::Half4:
+            return GL_HALF_FLOAT;
+        case ShaderDataType::Byte4:
+            return GL_BYTE;
+        case ShaderDataType::UByte4:
+            return GL_UNSIGNED_BYTE;
+        case ShaderDataType::Short2:
+        case ShaderDataType::Short4:
+            return GL_SHORT;
+        case ShaderDataType::Int1010102:
+            return GL_INT_2_10_10_10_REV;
         }
 
         ANTOMIC_ASSERT(false, "ShaderDataTypeGLEnum: Unknown data type")
@@ -70,13 +85,73 @@ namespace Antomic
             return 4;
         case ShaderDataType::Bool:
             return 1;
+        case ShaderDataType::Half2:
+            return 2;
+        case ShaderDataType::Half4:
+            return 4;
+        case ShaderDataType::Byte4:
+        case ShaderDataType::UByte4:
+            return 4;
+        case ShaderDataType::Short2:
+            return 2;
+        case ShaderDataType::Short4:
+            return 4;
+        case ShaderDataType::Int1010102:
+            return 4;
         }
 
         ANTOMIC_ASSERT(false, "ShaderDataTypeGLSize: Unknown data type")
         return GL_UNSIGNED_SHORT;
     }
 
+    ShaderDataType ShaderDataTypeFromGL(GLenum t)
+    {
+        switch (t)
+        {
+        case GL_FLOAT:
+            return ShaderDataType::Float;
+        case GL_FLOAT_VEC2:
+            return ShaderDataType::Vec2;
+        case GL_FLOAT_VEC3:
+            return ShaderDataType::Vec3;
+        case GL_FLOAT_VEC4:
+            return ShaderDataType::Vec4;
+        case GL_FLOAT_MAT3:
+            return ShaderDataType::Mat3;
+        case GL_FLOAT_MAT4:
+            return ShaderDataType::Mat4;
+        case GL_INT_VEC2:
+            return ShaderDataType::Int2;
+        case GL_INT_VEC3:
+            return ShaderDataType::Int3;
+        case GL_INT_VEC4:
+            return ShaderDataType::Int4;
+        case GL_BOOL:
+            return ShaderDataType::Bool;
+        default:
+            // Samplers are set as integers
+            return ShaderDataType::Int;
+        }
+    }
+
     OpenGLShader::OpenGLShader(const std::string &vertexSrc, const std::string &fragmentSrc)
+    {
+        ANTOMIC_ASSERT(Platform::IsContextCurrent(), "OpenGLShader: Created without the render context, use Application::RunOnRenderThread");
+        // A cached binary skips compiling and linking both stages
+        auto key = ShaderCache::Hash({GetDriverId(), vertexSrc, fragmentSrc});
+        if (!LoadBinary(key))
+        {
+            if (!Compile(vertexSrc, fragmentSrc))
+            {
+                return;
+            }
+            StoreBinary(key);
+        }
+
+        ReflectUniforms();
+    }
+
+    bool OpenGLShader::Compile(const std::string &vertexSrc, const std::string &fragmentSrc)
     {
         GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
         const GLchar *source = vertexSrc.c_str();
@@ -96,7 +171,7 @@ namespace Antomic
             glDeleteShader(vertexShader);
             ANTOMIC_ERROR("{0}", infoLog.data());
             ANTOMIC_ASSERT(false, "Vertex shader compilation error!");
-            return;
+            return false;
         }
 
         GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
@@ -118,7 +193,7 @@ namespace Antomic
 
             ANTOMIC_ERROR("{0}", infoLog.data());
             ANTOMIC_ASSERT(false, "Fragment shader compilation error!");
-            return;
+            return false;
         }
 
         mRendererId = glCreateProgram();
@@ -126,6 +201,7 @@ namespace Antomic
         glAttachShader(mRendererId, vertexShader);
         glAttachShader(mRendererId, fragmentShader);
 
+        glProgramParameteri(mRendererId, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
         glLinkProgram(mRendererId);
 
         GLint isLinked = 0;
@@ -139,86 +215,234 @@ namespace Antomic
             glGetProgramInfoLog(mRendererId, maxLength, &maxLength, &infoLog[0]);
 
             glDeleteProgram(mRendererId);
+            mRendererId = 0;
             glDeleteShader(vertexShader);
             glDeleteShader(fragmentShader);
 
             ANTOMIC_ERROR("{0}", infoLog.data());
             ANTOMIC_ASSERT(false, "Shader Program link  error!");
-            return;
+            return false;
         }
 
         // Always detach shaders after a successful link.
         glDetachShader(mRendererId, vertexShader);
         glDetachShader(mRendererId, fragmentShader);
+        glDeleteShader(vertexShader);
+        glDeleteShader(fragmentShader);
+        return true;
+    }
+
+    bool OpenGLShader::LoadBinary(uint64_t key)
+    {
+        if (!IsBinarySupported())
+        {
+            return false;
+        }
+
+        uint32_t format = 0;
+        std::vector<uint8_t> binary;
+        if (!ShaderCache::Load(key, format, binary))
+        {
+            return false;
+        }
+
+        mRendererId = glCreateProgram();
+        glProgramBinary(mRendererId, format, binary.data(), (GLsizei)binary.size());
+
+        // Drivers reject binaries they did not produce, compile instead
+        GLint isLinked = 0;
+        glGetProgramiv(mRendererId, GL_LINK_STATUS, &isLinked);
+        if (isLinked == GL_FALSE)
+        {
+            glDeleteProgram(mRendererId);
+            mRendererId = 0;
+            ShaderCache::Remove(key);
+            return false;
+        }
+
+        return true;
+    }
+
+    void OpenGLShader::StoreBinary(uint64_t key)
+    {
+        if (!IsBinarySupported() || !ShaderCache::IsEnabled())
+        {
+            return;
+        }
+
+        GLint length = 0;
+        glGetProgramiv(mRendererId, GL_PROGRAM_BINARY_LENGTH, &length);
+        if (length <= 0)
+        {
+            return;
+        }
+
+        GLenum format = 0;
+        std::vector<uint8_t> binary(length);
+        glGetProgramBinary(mRendererId, length, &length, &format, binary.data());
+        binary.resize(length);
+        ShaderCache::Store(key, format, binary);
+    }
+
+    bool OpenGLShader::IsBinarySupported()
+    {
+        static GLint formats = -1;
+        if (formats == -1)
+        {
+            glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+        }
+        return formats > 0;
+    }
+
+    const std::string &OpenGLShader::GetDriverId()
+    {
+        // Binaries are only valid for the driver that produced them
+        static std::string driver;
+        if (driver.empty())
+        {
+            auto text = [](GLenum name) {
+                const GLubyte *value = glGetString(name);
+                return value != nullptr ? std::string(reinterpret_cast<const char *>(value)) : std::string();
+            };
+            driver = text(GL_VENDOR) + "|" + text(GL_RENDERER) + "|" + text(GL_VERSION);
+        }
+        return driver;
+    }
+
+
+    void OpenGLShader::ReflectUniforms()
+    {
+        GLint count = 0, maxLength = 0;
+        glGetProgramiv(mRendererId, GL_ACTIVE_UNIFORMS, &count);
+        glGetProgramiv(mRendererId, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+
+        std::vector<GLchar> name(maxLength);
+        for (GLint i = 0; i < count; i++)
+        {
+            GLint size = 0;
+            GLenum type = 0;
+            GLsizei length = 0;
+            glGetActiveUniform(mRendererId, i, maxLength, &length, &size, &type, name.data());
+
+            // Uniforms inside blocks have no location
+            auto location = glGetUniformLocation(mRendererId, name.data());
+            if (location == -1)
+            {
+                continue;
+            }
+
+            // Arrays are reported as "name[0]"
+            std::string uniform(name.data(), length);
+            auto bracket = uniform.find('[');
+            if (bracket != std::string::npos)
+            {
+                uniform.resize(bracket);
+            }
+
+            mUniforms[uniform] = {location, ShaderDataTypeFromGL(type), (uint32_t)size};
+        }
+    }
+
+    const ShaderUniform *OpenGLShader::GetUniform(const std::string &name) const
+    {
+        auto it = mUniforms.find(name);
+        return it == mUniforms.end() ? nullptr : &it->second;
     }
 
     OpenGLShader::~OpenGLShader()
     {
-        glDeleteProgram(mRendererId);
+        OpenGLState::Delete([id = mRendererId]() {
+            OpenGLState::ReleaseProgram(id);
+            glDeleteProgram(id);
+        });
     }
 
     void OpenGLShader::Bind() const
     {
-        glUseProgram(mRendererId);
+        OpenGLState::UseProgram(mRendererId);
     }
 
     void OpenGLShader::Unbind() const
     {
-        glUseProgram(0);
+        OpenGLState::UseProgram(0);
     }
 
-    void OpenGLShader::SetUniformValue(const std::string &name, float value)
+    void OpenGLShader::SetUniformValue(UniformHandle<float> handle, float value)
     {
-        GLint loc = glGetUniformLocation(mRendererId, name.c_str());
-        if (loc != -1)
+        if (handle.IsValid())
         {
-            glUniform1f(loc, value);
+            glProgramUniform1f(mRendererId, handle.GetLocation(), value);
         }
     }
 
-    void OpenGLShader::SetUniformValue(const std::string &name, const glm::vec2 &value)
+    void OpenGLShader::SetUniformValue(UniformHandle<glm::vec2> handle, const glm::vec2 &value)
     {
-        GLint loc = glGetUniformLocation(mRendererId, name.c_str());
-        if (loc != -1)
+        if (handle.IsValid())
         {
-            glUniform2f(loc, value.x, value.y);
+            glProgramUniform2f(mRendererId, handle.GetLocation(), value.x, value.y);
         }
     }
 
-    void OpenGLShader::SetUniformValue(const std::string &name, const glm::vec3 &value)
+    void OpenGLShader::SetUniformValue(UniformHandle<glm::vec3> handle, const glm::vec3 &value)
     {
-        GLint loc = glGetUniformLocation(mRendererId, name.c_str());
-        if (loc != -1)
+        if (handle.IsValid())
         {
-            glUniform3f(loc, value.x, value.y, value.z);
+            glProgramUniform3f(mRendererId, handle.GetLocation(), value.x, value.y, value.z);
         }
     }
 
-    void OpenGLShader::SetUniformValue(const std::string &name, const glm::vec4 &value)
+    void OpenGLShader::SetUniformValue(UniformHandle<glm::vec4> handle, const glm::vec4 &value)
     {
-        GLint loc = glGetUniformLocation(mRendererId, name.c_str());
-        if (loc != -1)
+        if (handle.IsValid())
         {
-            glUniform4f(loc, value.x, value.y, value.z, value.w);
+            glProgramUniform4f(mRendererId, handle.GetLocation(), value.x, value.y, value.z, value.w);
         }
     }
 
-    void OpenGLShader::SetUniformValue(const std::string &name, const glm::mat3 &value)
+    void OpenGLShader::SetUniformValue(UniformHandle<glm::mat3> handle, const glm::mat3 &value)
     {
-        GLint loc = glGetUniformLocation(mRendererId, name.c_str());
-        if (loc != -1)
+        if (handle.IsValid())
         {
-            glUniformMatrix3fv(loc, 1, GL_FALSE, glm::value_ptr(value));
+            glProgramUniformMatrix3fv(mRendererId, handle.GetLocation(), 1, GL_FALSE, glm::value_ptr(value));
         }
     }
 
-    void OpenGLShader::SetUniformValue(const std::string &name, const glm::mat4 &value)
+    void OpenGLShader::SetUniformValue(UniformHandle<glm::mat4> handle, const glm::mat4 &value)
     {
-        GLint loc = glGetUniformLocation(mRendererId, name.c_str());
-        if (loc != -1)
+        if (handle.IsValid())
         {
-            glUniformMatrix4fv(loc, 1, GL_FALSE, glm::value_ptr(value));
+            glProgramUniformMatrix4fv(mRendererId, handle.GetLocation(), 1, GL_FALSE, glm::value_ptr(value));
         }
     }
 
+    void OpenGLShader::SetUniformValue(const std::string &name, float value)
+    {
+        SetUniformValue(GetUniformHandle<float>(name), value);
+    }
+
+    void OpenGLShader::SetUniformValue(const std::string &name, const glm::vec2 &value)
+    {
+        SetUniformValue(GetUniformHandle<glm::vec2>(name), value);
+    }
+
+    void OpenGLShader::SetUniformValue(const std::string &name, const glm::vec3 &value)
+    {
+        SetUniformValue(GetUniformHandle<glm::vec3>(name), value);
+    }
+
+    void OpenGLShader::SetUniformValue(const std::string &name, const glm::vec4 &value)
+    {
+        SetUniformValue(GetUniformHandle<glm::vec4>(name), value);
+    }
+
+    void OpenGLShader::SetUniformValue(const std::string &name, const glm::mat3 &value)
+    {
+        SetUniformValue(GetUniformHandle<glm::mat3>(name), value);
+    }
+
+    void OpenGLShader::SetUniformValue(const std::string &name, const glm::mat4 &value)
+    {
+        SetUniformValue(GetUniformHandle<glm::mat4>(name), value);
+    }
+
 } // namespace Antomic
\ No newline at end of file
@@ -22,6 +22,7 @@ namespace Antomic
 {
     GLenum ShaderDataTypeGLEnum(ShaderDataType t);
     GLint  ShaderDataTypeGLSize(ShaderDataType t);
+    ShaderDataType ShaderDataTypeFromGL(GLenum t);
 
     class OpenGLShader : public Shader
     {
@@ -34,6 +35,19 @@ namespace Antomic
         virtual void Bind() const override;
         virtual void Unbind() const override;
 
+        inline GLuint GetRendererId() const { return mRendererId; }
+
+        // Uniform reflection
+        virtual const ShaderUniform *GetUniform(const std::string &name) const override;
+
+        // Typed Uniform Commands
+        virtual void SetUniformValue(UniformHandle<float> handle, float value) override;
+        virtual void SetUniformValue(UniformHandle<glm::vec2> handle, const glm::vec2 &value) override;
+        virtual void SetUniformValue(UniformHandle<glm::vec3> handle, const glm::vec3 &value) override;
+        virtual void SetUniformValue(UniformHandle<glm::vec4> handle, const glm::vec4 &value) override;
+        virtual void SetUniformValue(UniformHandle<glm::mat3> handle, const glm::mat3 &value) override;
+        virtual void SetUniformValue(UniformHandle<glm::mat4> handle, const glm::mat4 &value) override;
+
         // Uniform Commands
         virtual void SetUniformValue(const std::string& name, float value) override;
         virtual void SetUniformValue(const std::string& name, const glm::vec2 &value) override;
@@ -42,8 +56,18 @@ namespace Antomic
         virtual void SetUniformValue(const std::string& name, const glm::mat3 &value) override;
         virtual void SetUniformValue(const std::string& name, const glm::mat4 &value) override;
 
+    private:
+        bool Compile(const std::string &vertexSrc, const std::string &fragmentSrc);
+        bool LoadBinary(uint64_t key);
+        void StoreBinary(uint64_t key);
+        void ReflectUniforms();
+
+        static bool IsBinarySupported();
+        static const std::string &GetDriverId();
+
     private:
         GLuint mRendererId = 0;
+        std::unordered_map<std::string, ShaderUniform> mUniforms;
     };
 
 } // namespace Antomic
@@ -0,0 +1,265 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "Platform/OpenGL/State.h"
+#include "Platform/Platform.h"
+#include "Core/Log.h"
+
+namespace Antomic
+{
+    static const GLuint sInvalid = std::numeric_limits<GLuint>::max();
+    static const uint32_t sMaxTextureUnits = 32;
+    static const uint32_t sMaxUniformBindings = 36;
+
+    struct OpenGLStateCache
+    {
+        GLuint Program = sInvalid;
+        GLuint VertexArray = sInvalid;
+        GLuint ArrayBuffer = sInvalid;
+        GLuint ElementBuffer = sInvalid;
+        GLuint UniformBuffer = sInvalid;
+        GLuint ActiveUnit = 0;
+        std::array<GLuint, sMaxTextureUnits> Textures;
+        std::array<GLuint, sMaxUniformBindings> UniformBindings;
+        glm::ivec4 Viewport = glm::ivec4(-1);
+        glm::vec4 ClearColor = glm::vec4(-1.0f);
+
+        OpenGLStateCache()
+        {
+            Textures.fill(sInvalid);
+            UniformBindings.fill(sInvalid);
+        }
+    };
+
+    static OpenGLStateCache sCache;
+    static OpenGLStateStats sStats;
+
+    // Releases from threads without the context, the main thread mostly
+    static std::mutex sReleasedMutex;
+    static std::vector<std::function<void()>> sReleased;
+
+    // Returns true if the value changed and the call must be issued
+    template <typename T>
+    static bool Update(T &cached, const T &value)
+    {
+        if (cached == value)
+        {
+            sStats.Skipped++;
+            return false;
+        }
+
+        cached = value;
+        sStats.Issued++;
+        return true;
+    }
+
+    static GLuint *BufferBinding(GLenum target)
+    {
+        switch (target)
+        {
+        case GL_ARRAY_BUFFER:
+            return &sCache.ArrayBuffer;
+        case GL_ELEMENT_ARRAY_BUFFER:
+            return &sCache.ElementBuffer;
+        case GL_UNIFORM_BUFFER:
+            return &sCache.UniformBuffer;
+        default:
+            return nullptr;
+        }
+    }
+
+    void OpenGLState::UseProgram(GLuint program)
+    {
+        if (Update(sCache.Program, program))
+        {
+            glUseProgram(program);
+        }
+    }
+
+    void OpenGLState::BindVertexArray(GLuint vertexArray)
+    {
+        if (Update(sCache.VertexArray, vertexArray))
+        {
+            glBindVertexArray(vertexArray);
+
+            // The element buffer binding is part of the vertex array state
+            sCache.ElementBuffer = sInvalid;
+        }
+    }
+
+    void OpenGLState::BindBuffer(GLenum target, GLuint buffer)
+    {
+        auto binding = BufferBinding(target);
+        if (binding == nullptr)
+        {
+            sStats.Issued++;
+            glBindBuffer(target, buffer);
+            return;
+        }
+
+        if (Update(*binding, buffer))
+        {
+            glBindBuffer(target, buffer);
+        }
+    }
+
+    void OpenGLState::BindBufferBase(GLenum target, GLuint index, GLuint buffer)
+    {
+        // Only the uniform buffer binding points are shadowed
+        if (target == GL_UNIFORM_BUFFER && index < sMaxUniformBindings)
+        {
+            if (!Update(sCache.UniformBindings[index], buffer))
+            {
+                return;
+            }
+        }
+        else
+        {
+            sStats.Issued++;
+        }
+
+        glBindBufferBase(target, index, buffer);
+
+        auto binding = BufferBinding(target);
+        if (binding != nullptr)
+        {
+            *binding = buffer;
+        }
+    }
+
+    void OpenGLState::BindTexture(GLuint texture)
+    {
+        if (Update(sCache.Textures[sCache.ActiveUnit], texture))
+        {
+            glBindTexture(GL_TEXTURE_2D, texture);
+        }
+    }
+
+    void OpenGLState::BindTextureUnit(GLuint unit, GLuint texture)
+    {
+        ANTOMIC_ASSERT(unit < sMaxTextureUnits, "OpenGLState: Texture unit out of range!");
+        if (Update(sCache.Textures[unit], texture))
+        {
+            glBindTextureUnit(unit, texture);
+        }
+    }
+
+    void OpenGLState::SetViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+    {
+        if (Update(sCache.Viewport, glm::ivec4(x, y, width, height)))
+        {
+            glViewport(x, y, width, height);
+        }
+    }
+
+    void OpenGLState::SetClearColor(const glm::vec4 &color)
+    {
+        if (Update(sCache.ClearColor, color))
+        {
+            glClearColor(color.r, color.g, color.b, color.a);
+        }
+    }
+
+    void OpenGLState::ReleaseProgram(GLuint program)
+    {
+        if (sCache.Program == program)
+        {
+            sCache.Program = sInvalid;
+        }
+    }
+
+    void OpenGLState::ReleaseVertexArray(GLuint vertexArray)
+    {
+        if (sCache.VertexArray == vertexArray)
+        {
+            sCache.VertexArray = sInvalid;
+            sCache.ElementBuffer = sInvalid;
+        }
+    }
+
+    void OpenGLState::ReleaseBuffer(GLuint buffer)
+    {
+        for (auto binding : {&sCache.ArrayBuffer, &sCache.ElementBuffer, &sCache.UniformBuffer})
+        {
+            if (*binding == buffer)
+            {
+                *binding = sInvalid;
+            }
+        }
+
+        for (auto &binding : sCache.UniformBindings)
+        {
+            if (binding == buffer)
+            {
+                binding = sInvalid;
+            }
+        }
+    }
+
+    void OpenGLState::ReleaseTexture(GLuint texture)
+    {
+        for (auto &binding : sCache.Textures)
+        {
+            if (binding == texture)
+            {
+                binding = sInvalid;
+            }
+        }
+    }
+
+    void OpenGLState::Delete(const std::function<void()> &release)
+    {
+        if (Platform::IsContextCurrent())
+        {
+            release();
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(sReleasedMutex);
+        sReleased.push_back(release);
+    }
+
+    void OpenGLState::CollectReleased()
+    {
+        ANTOMIC_ASSERT(Platform::IsContextCurrent(), "OpenGLState: Collecting released objects without the context!");
+
+        std::vector<std::function<void()>> released;
+        {
+            std::lock_guard<std::mutex> lock(sReleasedMutex);
+            released.swap(sReleased);
+        }
+
+        for (auto &release : released)
+        {
+            release();
+        }
+    }
+
+    void OpenGLState::Invalidate()
+    {
+        sCache = OpenGLStateCache();
+    }
+
+    const OpenGLStateStats &OpenGLState::GetStats()
+    {
+        return sStats;
+    }
+
+    void OpenGLState::ResetStats()
+    {
+        sStats = OpenGLStateStats();
+    }
+
+} // namespace Antomic
@@ -0,0 +1,68 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+#include "Core/Base.h"
+#include "glad/glad.h"
+#include "glm/glm.hpp"
+
+namespace Antomic
+{
+    struct OpenGLStateStats
+    {
+        uint64_t Issued = 0;
+        uint64_t Skipped = 0;
+    };
+
+    // Shadows the bound GL objects and fixed state, calls that would not
+    // change the current state never reach the driver. Every bind in the
+    // OpenGL backend must go through here for the shadow to stay valid.
+    class OpenGLState
+    {
+    public:
+        // Bind operations
+        static void UseProgram(GLuint program);
+        static void BindVertexArray(GLuint vertexArray);
+        static void BindBuffer(GLenum target, GLuint buffer);
+        // Also binds the buffer to the generic target, as GL does
+        static void BindBufferBase(GLenum target, GLuint index, GLuint buffer);
+        static void BindTexture(GLuint texture);
+        static void BindTextureUnit(GLuint unit, GLuint texture);
+
+        // Fixed state operations
+        static void SetViewport(GLint x, GLint y, GLsizei width, GLsizei height);
+        static void SetClearColor(const glm::vec4 &color);
+
+        // Objects about to be deleted, names may be reused by the driver
+        static void ReleaseProgram(GLuint program);
+        static void ReleaseVertexArray(GLuint vertexArray);
+        static void ReleaseBuffer(GLuint buffer);
+        static void ReleaseTexture(GLuint texture);
+
+        // GL objects can only be deleted where the context is current. Runs
+        // the release right away there, otherwise keeps it for the render
+        // thread to run on CollectReleased.
+        static void Delete(const std::function<void()> &release);
+        static void CollectReleased();
+
+        // Forget everything, for when GL is touched outside the backend
+        static void Invalidate();
+
+        // Statistics
+        static const OpenGLStateStats &GetStats();
+        static void ResetStats();
+    };
+
+} // namespace Antomic
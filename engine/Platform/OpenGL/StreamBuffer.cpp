@@ -0,0 +1,102 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "Platform/OpenGL/StreamBuffer.h"
+#include "Platform/OpenGL/State.h"
+#include "Platform/Platform.h"
+#include "Core/Log.h"
+
+namespace Antomic
+{
+    OpenGLStreamBuffer::OpenGLStreamBuffer(uint32_t regionSize, uint32_t regions)
+        : StreamBuffer(regionSize, regions), mFences(regions, nullptr)
+    {
+        ANTOMIC_ASSERT(Platform::IsContextCurrent(), "OpenGLStreamBuffer: Created without the render context, use Application::RunOnRenderThread");
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        GLsizeiptr size = (GLsizeiptr)regionSize * regions;
+
+        glCreateBuffers(1, &mRendererId);
+        glNamedBufferStorage(mRendererId, size, nullptr, flags);
+        mMappedData = (uint8_t *)glMapNamedBufferRange(mRendererId, 0, size, flags);
+        ANTOMIC_ASSERT(mMappedData != nullptr, "OpenGLStreamBuffer: Unable to map buffer!");
+    }
+
+    OpenGLStreamBuffer::~OpenGLStreamBuffer()
+    {
+        OpenGLState::Delete([id = mRendererId, fences = mFences]() {
+            for (auto fence : fences)
+            {
+                if (fence != nullptr)
+                {
+                    glDeleteSync(fence);
+                }
+            }
+
+            glUnmapNamedBuffer(id);
+            OpenGLState::ReleaseBuffer(id);
+            glDeleteBuffers(1, &id);
+        });
+    }
+
+    void OpenGLStreamBuffer::Bind() const
+    {
+        OpenGLState::BindBuffer(GL_ARRAY_BUFFER, mRendererId);
+    }
+
+    void OpenGLStreamBuffer::Unbind() const
+    {
+        OpenGLState::BindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    void OpenGLStreamBuffer::PlaceFence(uint32_t region)
+    {
+        if (mFences[region] != nullptr)
+        {
+            glDeleteSync(mFences[region]);
+        }
+        mFences[region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+
+    void OpenGLStreamBuffer::WaitFence(uint32_t region)
+    {
+        auto fence = mFences[region];
+        if (fence == nullptr)
+        {
+            return;
+        }
+
+        // Flush on the first wait so the fence is guaranteed to signal
+        GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+        while (true)
+        {
+            auto result = glClientWaitSync(fence, flags, 1000000);
+            if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED)
+            {
+                break;
+            }
+
+            if (result == GL_WAIT_FAILED)
+            {
+                ANTOMIC_ERROR("OpenGLStreamBuffer: Failed waiting for region {0}", region);
+                break;
+            }
+            flags = 0;
+        }
+
+        glDeleteSync(fence);
+        mFences[region] = nullptr;
+    }
+
+} // namespace Antomic
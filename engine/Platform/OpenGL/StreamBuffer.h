@@ -0,0 +1,48 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+#include "Renderer/StreamBuffer.h"
+#include "glad/glad.h"
+
+namespace Antomic
+{
+    // Persistently and coherently mapped buffer storage, written by the
+    // CPU while the GPU reads the regions of previous frames
+    class OpenGLStreamBuffer : public StreamBuffer
+    {
+    public:
+        OpenGLStreamBuffer(uint32_t regionSize, uint32_t regions);
+        virtual ~OpenGLStreamBuffer() override;
+
+    public:
+        // Bind/Unbind commands
+        virtual void Bind() const override;
+        virtual void Unbind() const override;
+
+        inline GLuint GetRendererId() const { return mRendererId; }
+
+    protected:
+        virtual uint8_t *GetMappedData() override { return mMappedData; }
+        virtual void PlaceFence(uint32_t region) override;
+        virtual void WaitFence(uint32_t region) override;
+
+    private:
+        GLuint mRendererId;
+        uint8_t *mMappedData;
+        std::vector<GLsync> mFences;
+    };
+
+} // namespace Antomic
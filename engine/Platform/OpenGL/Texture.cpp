@@ -14,34 +14,188 @@
    limitations under the License.
 */
 #include "Platform/OpenGL/Texture.h"
+#include "Platform/OpenGL/State.h"
+#include "Platform/OpenGL/StreamBuffer.h"
+#include "Platform/Platform.h"
+
+// S3TC is an extension, not part of the core profile glad was built for
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT 0x83F1
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+#ifndef GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT 0x8C4D
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT 0x8C4F
+#endif
+
 namespace Antomic
 {
-    OpenGLTexture::OpenGLTexture(uint32_t width, uint32_t height, unsigned char *data)
+    static GLenum TextureFormatToInternalFormat(TextureFormat format)
+    {
+        switch (format)
+        {
+        case TextureFormat::R8:
+            return GL_R8;
+        case TextureFormat::RG8:
+            return GL_RG8;
+        case TextureFormat::RGB8:
+            return GL_RGB8;
+        case TextureFormat::RGBA8:
+            return GL_RGBA8;
+        case TextureFormat::SRGB8:
+            return GL_SRGB8;
+        case TextureFormat::SRGBA8:
+            return GL_SRGB8_ALPHA8;
+        case TextureFormat::BC1:
+            return GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+        case TextureFormat::BC1SRGB:
+            return GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT;
+        case TextureFormat::BC3:
+            return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+        case TextureFormat::BC3SRGB:
+            return GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT;
+        case TextureFormat::BC4:
+            return GL_COMPRESSED_RED_RGTC1;
+        case TextureFormat::BC5:
+            return GL_COMPRESSED_RG_RGTC2;
+        case TextureFormat::BC7:
+            return GL_COMPRESSED_RGBA_BPTC_UNORM;
+        case TextureFormat::BC7SRGB:
+            return GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM;
+        }
+
+        ANTOMIC_ASSERT(false, "Unknown TextureFormat!");
+        return 0;
+    }
+
+    static GLenum TextureFormatToDataFormat(TextureFormat format)
     {
-        glGenTextures(1, &mRendererID);
-        glBindTexture(GL_TEXTURE_2D, mRendererID);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, data);
-        glGenerateMipmap(GL_TEXTURE_2D);
-        glBindTexture(GL_TEXTURE_2D, 0);
+        switch (TextureFormatChannels(format))
+        {
+        case 1:
+            return GL_RED;
+        case 2:
+            return GL_RG;
+        case 3:
+            return GL_RGB;
+        default:
+            return GL_RGBA;
+        }
+    }
+
+    static GLenum TextureWrapToOpenGL(TextureWrap wrap)
+    {
+        switch (wrap)
+        {
+        case TextureWrap::MirroredRepeat:
+            return GL_MIRRORED_REPEAT;
+        case TextureWrap::ClampToEdge:
+            return GL_CLAMP_TO_EDGE;
+        default:
+            return GL_REPEAT;
+        }
+    }
+
+    OpenGLTexture::OpenGLTexture(const TextureSpecification &specification, unsigned char *data)
+        : Texture(specification), mInternalFormat(TextureFormatToInternalFormat(specification.Format)),
+          mDataFormat(TextureFormatToDataFormat(specification.Format))
+    {
+        ANTOMIC_ASSERT(Platform::IsContextCurrent(), "OpenGLTexture: Created without the render context, use Application::RunOnRenderThread");
+        // Immutable storage, every level is allocated once up front
+        glCreateTextures(GL_TEXTURE_2D, 1, &mRendererID);
+        glTextureStorage2D(mRendererID, mMipCount, mInternalFormat, specification.Width, specification.Height);
+
+        auto wrap = TextureWrapToOpenGL(specification.Wrap);
+        auto nearest = specification.Filter == TextureFilter::Nearest;
+        auto minFilter = nearest ? GL_NEAREST : GL_LINEAR;
+        if (mMipCount > 1)
+        {
+            minFilter = nearest ? GL_NEAREST_MIPMAP_NEAREST : GL_LINEAR_MIPMAP_LINEAR;
+        }
+        glTextureParameteri(mRendererID, GL_TEXTURE_WRAP_S, wrap);
+        glTextureParameteri(mRendererID, GL_TEXTURE_WRAP_T, wrap);
+        glTextureParameteri(mRendererID, GL_TEXTURE_MIN_FILTER, minFilter);
+        glTextureParameteri(mRendererID, GL_TEXTURE_MAG_FILTER, nearest ? GL_NEAREST : GL_LINEAR);
+
+        // Single channel images are grey, two channel ones grey and alpha.
+        // BC5 holds two independent channels, normal maps mostly
+        auto format = specification.Format;
+        if (format == TextureFormat::R8 || format == TextureFormat::BC4)
+        {
+            GLint swizzle[] = {GL_RED, GL_RED, GL_RED, GL_ONE};
+            glTextureParameteriv(mRendererID, GL_TEXTURE_SWIZZLE_RGBA, swizzle);
+        }
+        else if (format == TextureFormat::RG8)
+        {
+            GLint swizzle[] = {GL_RED, GL_RED, GL_RED, GL_GREEN};
+            glTextureParameteriv(mRendererID, GL_TEXTURE_SWIZZLE_RGBA, swizzle);
+        }
+
+        if (data != nullptr)
+        {
+            SetData(0, 0, specification.Width, specification.Height, data);
+        }
     }
 
     OpenGLTexture::~OpenGLTexture()
     {
-        glDeleteTextures(1, &mRendererID);
+        OpenGLState::Delete([id = mRendererID]() {
+            OpenGLState::ReleaseTexture(id);
+            glDeleteTextures(1, &id);
+        });
     }
 
     void OpenGLTexture::Bind() const
     {
-        glBindTexture(GL_TEXTURE_2D, mRendererID);
+        OpenGLState::BindTexture(mRendererID);
+    }
+
+    void OpenGLTexture::Bind(uint32_t slot) const
+    {
+        OpenGLState::BindTextureUnit(slot, mRendererID);
     }
 
     void OpenGLTexture::Unbind() const
     {
-        glBindTexture(GL_TEXTURE_2D, 0);
+        OpenGLState::BindTexture(0);
+    }
+
+    void OpenGLTexture::SetData(uint32_t x, uint32_t y, uint32_t width, uint32_t height, unsigned char *data)
+    {
+        // Rows with less than 4 channels are not 4 byte aligned for every width
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glTextureSubImage2D(mRendererID, 0, x, y, width, height, mDataFormat, GL_UNSIGNED_BYTE, data);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        GenerateMips();
+    }
+
+    void OpenGLTexture::SetData(uint32_t x, uint32_t y, uint32_t width, uint32_t height, const StreamBuffer &staging, uint32_t offset)
+    {
+        // With a pixel unpack buffer bound the data pointer is an offset
+        OpenGLState::BindBuffer(GL_PIXEL_UNPACK_BUFFER, static_cast<const OpenGLStreamBuffer &>(staging).GetRendererId());
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glTextureSubImage2D(mRendererID, 0, x, y, width, height, mDataFormat, GL_UNSIGNED_BYTE, (const void *)(uintptr_t)offset);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        OpenGLState::BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        GenerateMips();
+    }
+
+    void OpenGLTexture::SetCompressedData(uint32_t level, const unsigned char *data, uint32_t size)
+    {
+        ANTOMIC_ASSERT(TextureFormatIsCompressed(mSpecification.Format), "Texture is not compressed!");
+        auto width = std::max(1u, mSpecification.Width >> level);
+        auto height = std::max(1u, mSpecification.Height >> level);
+        glCompressedTextureSubImage2D(mRendererID, level, 0, 0, width, height, mInternalFormat, size, data);
+    }
+
+    void OpenGLTexture::GenerateMips()
+    {
+        // Lower levels follow the base level after every upload, compressed
+        // textures bring their own
+        if (mMipCount > 1 && !TextureFormatIsCompressed(mSpecification.Format))
+        {
+            glGenerateTextureMipmap(mRendererID);
+        }
     }
 
 } // namespace Anatomic
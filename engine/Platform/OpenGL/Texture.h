@@ -23,16 +23,28 @@ namespace Antomic
     class OpenGLTexture : public Texture
     {
     public:
-        OpenGLTexture(uint32_t width, uint32_t height, unsigned char* data);
+        OpenGLTexture(const TextureSpecification &specification, unsigned char *data);
         virtual ~OpenGLTexture();
 
     public:
         // Bind/Unbind commands
         virtual void Bind() const override;
+        virtual void Bind(uint32_t slot) const override;
         virtual void Unbind() const override;
+        inline GLuint GetRendererId() const { return mRendererID; }
+
+        // Texture commands
+        virtual void SetData(uint32_t x, uint32_t y, uint32_t width, uint32_t height, unsigned char *data) override;
+        virtual void SetData(uint32_t x, uint32_t y, uint32_t width, uint32_t height, const StreamBuffer &staging, uint32_t offset) override;
+        virtual void SetCompressedData(uint32_t level, const unsigned char *data, uint32_t size) override;
+
+    private:
+        void GenerateMips();
 
     private:
         GLuint mRendererID;
+        GLenum mInternalFormat;
+        GLenum mDataFormat;
     };
     
 } // namespace Antomic
@@ -14,52 +14,92 @@
    limitations under the License.
 */
 #include "Platform/OpenGL/VertexArray.h"
+#include "Platform/OpenGL/State.h"
 #include "Platform/OpenGL/Shader.h"
+#include "Platform/Platform.h"
+#include "Core/Log.h"
 #include "glad/glad.h"
 
 namespace Antomic
 {
     OpenGLVertexArray::OpenGLVertexArray()
     {
+        ANTOMIC_ASSERT(Platform::IsContextCurrent(), "OpenGLVertexArray: Created without the render context, use Application::RunOnRenderThread");
         glCreateVertexArrays(1, &mRendererId);
     }
 
     OpenGLVertexArray::~OpenGLVertexArray()
     {
-        glDeleteVertexArrays(1, &mRendererId);
+        OpenGLState::Delete([id = mRendererId]() {
+            OpenGLState::ReleaseVertexArray(id);
+            glDeleteVertexArrays(1, &id);
+        });
     }
 
     void OpenGLVertexArray::Bind() const
     {
-        glBindVertexArray(mRendererId);
+        OpenGLState::BindVertexArray(mRendererId);
     }
 
     void OpenGLVertexArray::Unbind() const
     {
-        glBindVertexArray(0);
+        OpenGLState::BindVertexArray(0);
     }
 
     void OpenGLVertexArray::AddVertexBuffer(const Ref<VertexBuffer> &buffer)
     {
-        glBindVertexArray(mRendererId);
+        mAttributeIndex = AddAttributes(buffer, mAttributeIndex, 0);
+        ANTOMIC_ASSERT(mAttributeIndex <= InstanceAttributeBase, "OpenGLVertexArray: Vertex attributes overlap the instance ones!");
+        mVertextBuffers.push_back(buffer);
+    }
+
+    void OpenGLVertexArray::SetInstanceBuffer(const Ref<VertexBuffer> &buffer)
+    {
+        ANTOMIC_ASSERT(mInstanceBuffer == nullptr, "OpenGLVertexArray: Instance buffer already set!");
+        AddAttributes(buffer, InstanceAttributeBase, 1);
+        mInstanceBuffer = buffer;
+    }
+
+    uint32_t OpenGLVertexArray::AddAttributes(const Ref<VertexBuffer> &buffer, uint32_t location, uint32_t divisor)
+    {
+        OpenGLState::BindVertexArray(mRendererId);
         buffer->Bind();
         auto const &layout = buffer->Layout();
-        uint32_t index = 0;
         for (auto &element : layout.Elements())
         {
-            glEnableVertexAttribArray(index);
-            glVertexAttribPointer(
-                index, ShaderDataTypeGLSize(element.Type),
-                ShaderDataTypeGLEnum(element.Type), element.Normalized ? GL_TRUE : GL_FALSE,
-                layout.Stride(), (const GLvoid *)((intptr_t)element.Offset));
-            index++;
+            // Matrices take one attribute location per column
+            uint32_t columns = 1;
+            switch (element.Type)
+            {
+            case ShaderDataType::Mat3:
+                columns = 3;
+                break;
+            case ShaderDataType::Mat4:
+                columns = 4;
+                break;
+            default:
+                break;
+            }
+
+            auto size = ShaderDataTypeGLSize(element.Type) / columns;
+            for (uint32_t column = 0; column < columns; column++)
+            {
+                glEnableVertexAttribArray(location);
+                glVertexAttribPointer(
+                    location, size,
+                    ShaderDataTypeGLEnum(element.Type), element.Normalized ? GL_TRUE : GL_FALSE,
+                    layout.Stride(), (const GLvoid *)((intptr_t)(element.Offset + column * size * sizeof(float))));
+                glVertexAttribDivisor(location, divisor);
+                location++;
+            }
         }
-        mVertextBuffers.push_back(buffer);
+
+        return location;
     }
     
     void OpenGLVertexArray::SetIndexBuffer(const Ref<IndexBuffer> &buffer)
     {
-        glBindVertexArray(mRendererId);
+        OpenGLState::BindVertexArray(mRendererId);
         buffer->Bind();
         mIndexBuffer = buffer;
     }
@@ -28,14 +28,23 @@ namespace Antomic {
     public:
         virtual void Bind() const override;
         virtual void Unbind() const override;
+        inline uint32_t GetRendererId() const { return mRendererId; }
         virtual void AddVertexBuffer(const Ref<VertexBuffer> &buffer) override;
         virtual void SetIndexBuffer(const Ref<IndexBuffer> &buffer) override;
         virtual const std::vector<Ref<VertexBuffer>> &GetVertexBuffers() const override { return mVertextBuffers; };
         virtual const Ref<IndexBuffer> &GetIndexBuffer() const override { return mIndexBuffer; };
+        virtual void SetInstanceBuffer(const Ref<VertexBuffer> &buffer) override;
+        virtual const Ref<VertexBuffer> &GetInstanceBuffer() const override { return mInstanceBuffer; };
         
+    private:
+        // Returns the location after the last one used
+        uint32_t AddAttributes(const Ref<VertexBuffer> &buffer, uint32_t location, uint32_t divisor);
+
     private:
         uint32_t mRendererId;
+        uint32_t mAttributeIndex = 0;
         std::vector<Ref<VertexBuffer>> mVertextBuffers;
         Ref<IndexBuffer> mIndexBuffer;
+        Ref<VertexBuffer> mInstanceBuffer;
     };
 }
\ No newline at end of file
@@ -16,6 +16,7 @@
 #include "Platform/Platform.h"
 #include "Core/Log.h"
 #include "Platform/RenderAPI.h"
+#include "Platform/Headless/Platform.h"
 #ifdef ANTOMIC_PLATFORM_WINDOWS
 #include "Platform/Windows/Platform.h"
 #elif ANTOMIC_PLATFORM_LINUX
@@ -94,4 +95,20 @@ namespace Antomic
         return false;
 #endif
     }
+
+    bool Platform::SetupHeadlessPlatform(uint32_t width, uint32_t height, std::string title, const HeadlessSettings &settings)
+    {
+        ANTOMIC_ASSERT(!sPlatform, "Platform: Platform already created!");
+
+        sPlatform = CreateScope<HeadlessPlatform>(settings);
+
+        // Frames are still built and recorded, nothing reaches a GPU
+        sRenderAPI = RenderAPI::Create(RenderAPIDialect::NONE);
+        sRenderAPIDialect = RenderAPIDialect::NONE;
+
+        sWindow = sPlatform->CreateWindow(width, height, title, RenderAPIDialect::NONE);
+        sInput = sPlatform->CreateInput();
+
+        return true;
+    }
 } // namespace Antomic
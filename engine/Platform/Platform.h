@@ -22,6 +22,8 @@
 
 namespace Antomic
 {
+    struct HeadlessSettings;
+
     class Platform
     {
 
@@ -38,6 +40,9 @@ namespace Antomic
 
     public:
         static bool SetupPlatform(uint32_t width, uint32_t height, std::string title, RenderAPIDialect api = RenderAPIDialect::OPENGL);
+
+        // No window or display, for benchmarks and tests
+        static bool SetupHeadlessPlatform(uint32_t width, uint32_t height, std::string title, const HeadlessSettings &settings);
         
         // Render API
         inline static const Scope<RenderAPI> &GetRenderAPI() { return sRenderAPI; }
@@ -53,6 +58,9 @@ namespace Antomic
         // Window Operations & Handling
         inline static const Scope<Window> &GetWindow() { return sWindow; }
         inline static void SwapBuffer() { sWindow->SwapBuffer(); }
+        inline static void MakeContextCurrent(bool current) { sWindow->MakeContextCurrent(current); }
+        // True on the thread the render context is current on
+        inline static bool IsContextCurrent() { return sWindow != nullptr && sWindow->IsContextCurrent(); }
         inline static uint32_t GetWindowWidth() { return sWindow->GetWidth(); }
         inline static uint32_t GetWindowHeight() { return sWindow->GetHeight(); }
         inline static const std::string &GetWindowTitle() { return sWindow->GetTitle(); }
@@ -39,7 +39,15 @@ namespace Antomic
         virtual void SetViewport(const uint32_t &x, const uint32_t &y, uint32_t const &width, uint32_t const &height) = 0;
         virtual void SetClearColor(glm::vec4 color) = 0;
         virtual void Clear() = 0;
-        virtual void DrawIndexed(const Ref<VertexArray> vertexArray) = 0;
+        virtual void DrawIndexed(const Ref<VertexArray> vertexArray, uint32_t indexCount = 0, uint32_t baseVertex = 0) = 0;
+        virtual void DrawIndexedInstanced(const Ref<VertexArray> vertexArray, uint32_t instanceCount, uint32_t indexCount = 0) = 0;
+
+        // Runs the commands recorded on the buffer, in order
+        virtual void Execute(const CommandBuffer &commands) = 0;
+
+        // Deletes the objects released while the context was current on
+        // another thread, runs on the thread owning the context
+        virtual void CollectReleased() = 0;
 
     public:
         static Scope<RenderAPI> Create(RenderAPIDialect api = RenderAPIDialect::OPENGL);
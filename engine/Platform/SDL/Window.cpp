@@ -247,6 +247,22 @@ namespace Antomic
 #endif
     }
 
+    void SDLWindow::MakeContextCurrent(bool current)
+    {
+#ifdef ANTOMIC_GL_RENDERER
+        SDL_GL_MakeCurrent(mWindow, current ? mGLContext : nullptr);
+#endif
+    }
+
+    bool SDLWindow::IsContextCurrent() const
+    {
+#ifdef ANTOMIC_GL_RENDERER
+        return SDL_GL_GetCurrentContext() == mGLContext;
+#else
+        return true;
+#endif
+    }
+
     void SDLWindow::ProcessEvents()
     {
         SDL_Event e;
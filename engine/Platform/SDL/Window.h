@@ -35,6 +35,8 @@ namespace Antomic
         virtual bool IsValid() const override { return mWindow != nullptr; };
         virtual void SetEventHandler(const EventHandler &handler) override { mData.Handler = handler; } 
         virtual void SwapBuffer() override;
+        virtual void MakeContextCurrent(bool current) override;
+        virtual bool IsContextCurrent() const override;
         virtual void ProcessEvents() override;
         virtual void ToggleFullscreen() override;
         virtual void SetMouseLock(bool lock) override;
@@ -40,6 +40,8 @@ namespace Antomic
         virtual bool IsValid() const = 0;
         virtual void SetEventHandler(const EventHandler &handler) = 0;
         virtual void SwapBuffer() = 0;
+        virtual void MakeContextCurrent(bool current) = 0;
+        virtual bool IsContextCurrent() const = 0;
         virtual void ProcessEvents() = 0;
         virtual void ToggleFullscreen() = 0;
         virtual void SetMouseLock(bool lock) = 0;
@@ -104,6 +104,24 @@ namespace Antomic
 			mTraceEvents.push_back(traceEvent);
 		}
 
+		// Counter event, every value in args is drawn as a series of the
+		// counter named name
+		void WriteCounter(const std::string &name, const std::string &category, const nlohmann::json &args)
+		{
+			auto now = FloatingPointMicroseconds{std::chrono::steady_clock::now().time_since_epoch()};
+
+			nlohmann::json traceEvent;
+			traceEvent["cat"] = "counter," + category;
+			traceEvent["name"] = name;
+			traceEvent["ph"] = "C";
+			traceEvent["pid"] = GET_PROCESS_ID();
+			traceEvent["ts"] = now.count();
+			traceEvent["args"] = args;
+
+			std::lock_guard lock(mMutex);
+			mTraceEvents.push_back(traceEvent);
+		}
+
 		static Instrumentor &Get()
 		{
 			static Instrumentor instance;
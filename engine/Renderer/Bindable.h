@@ -17,6 +17,8 @@
 
 namespace Antomic
 {
+    class CommandBuffer;
+
     class Bindable
     {
     public:
@@ -25,5 +27,8 @@ namespace Antomic
     public:
         virtual void Bind() const = 0;
         virtual void Unbind() const = 0;        
+
+        // Records the bind into a command buffer instead of binding now
+        virtual void Record(CommandBuffer &commands) const = 0;
     };
 } // namespace Antomic
\ No newline at end of file
@@ -0,0 +1,116 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+#include "Core/Base.h"
+#include "glm/glm.hpp"
+
+namespace Antomic
+{
+    /*************************************************************
+     * BoundingBox Implementation
+     *************************************************************/
+
+    // Axis aligned box. A default box is empty, an infinite box stands
+    // for bounds that are not known and is never culled.
+    struct BoundingBox
+    {
+        glm::vec3 Min = glm::vec3(std::numeric_limits<float>::infinity());
+        glm::vec3 Max = glm::vec3(-std::numeric_limits<float>::infinity());
+
+        BoundingBox() = default;
+        BoundingBox(const glm::vec3 &min, const glm::vec3 &max) : Min(min), Max(max) {}
+
+        inline bool IsEmpty() const { return Min.x > Max.x || Min.y > Max.y || Min.z > Max.z; }
+        inline bool IsInfinite() const { return Min.x == -std::numeric_limits<float>::infinity(); }
+        inline glm::vec3 GetCenter() const { return (Min + Max) * 0.5f; }
+        inline glm::vec3 GetExtents() const { return (Max - Min) * 0.5f; }
+
+        inline void Merge(const BoundingBox &other)
+        {
+            Min = glm::min(Min, other.Min);
+            Max = glm::max(Max, other.Max);
+        }
+
+        // Box around this box once transformed by the matrix
+        BoundingBox Transform(const glm::mat4 &matrix) const
+        {
+            if (IsEmpty() || IsInfinite())
+            {
+                return *this;
+            }
+
+            auto center = glm::vec3(matrix * glm::vec4(GetCenter(), 1.0f));
+            auto extents = GetExtents();
+            auto worldExtents = glm::abs(glm::vec3(matrix[0])) * extents.x +
+                                glm::abs(glm::vec3(matrix[1])) * extents.y +
+                                glm::abs(glm::vec3(matrix[2])) * extents.z;
+            return BoundingBox(center - worldExtents, center + worldExtents);
+        }
+
+        static BoundingBox Infinite()
+        {
+            auto infinity = std::numeric_limits<float>::infinity();
+            return BoundingBox(glm::vec3(-infinity), glm::vec3(infinity));
+        }
+    };
+
+    /*************************************************************
+     * Rect Implementation
+     *************************************************************/
+
+    // Axis aligned rectangle in 2D world space, Min is the top left corner
+    struct Rect
+    {
+        glm::vec2 Min = glm::vec2(0.0f);
+        glm::vec2 Max = glm::vec2(0.0f);
+
+        Rect() = default;
+        Rect(const glm::vec2 &min, const glm::vec2 &max) : Min(min), Max(max) {}
+
+        inline bool Contains(const glm::vec2 &point) const
+        {
+            return point.x >= Min.x && point.y >= Min.y && point.x <= Max.x && point.y <= Max.y;
+        }
+
+        inline bool Contains(const Rect &other) const
+        {
+            return other.Min.x >= Min.x && other.Min.y >= Min.y && other.Max.x <= Max.x && other.Max.y <= Max.y;
+        }
+
+        inline bool Overlaps(const Rect &other) const
+        {
+            return other.Min.x <= Max.x && other.Min.y <= Max.y && other.Max.x >= Min.x && other.Max.y >= Min.y;
+        }
+
+        inline float Perimeter() const { return 2.0f * ((Max.x - Min.x) + (Max.y - Min.y)); }
+
+        // Rect around this rect once transformed by the matrix
+        Rect Transform(const glm::mat3 &matrix) const
+        {
+            auto center = glm::vec2(matrix * glm::vec3((Min + Max) * 0.5f, 1.0f));
+            auto extents = (Max - Min) * 0.5f;
+            auto worldExtents = glm::abs(glm::vec2(matrix[0])) * extents.x +
+                                glm::abs(glm::vec2(matrix[1])) * extents.y;
+            return Rect(center - worldExtents, center + worldExtents);
+        }
+
+        static inline Rect Merge(const Rect &a, const Rect &b)
+        {
+            return Rect(glm::min(a.Min, b.Min), glm::max(a.Max, b.Max));
+        }
+    };
+
+} // namespace Antomic
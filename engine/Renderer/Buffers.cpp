@@ -18,6 +18,7 @@
 #include "Platform/RenderAPI.h"
 #include "Platform/NullRenderer/Buffers.h"
 #include "Platform/Platform.h"
+#include <glm/gtc/type_ptr.hpp>
 #ifdef ANTOMIC_GL_RENDERER
 #include "Platform/OpenGL/Buffers.h"
 #endif
@@ -68,8 +69,11 @@ namespace Antomic
         // According to Sub-section 2.15.3.1.2 - Standard Uniform Block Layout
         // https://www.khronos.org/registry/OpenGL/extensions/ARB/ARB_uniform_buffer_object.txt
         mStride = 0;
-        for (auto &element : mElements)
+        mIndices.clear();
+        for (size_t i = 0; i < mElements.size(); i++)
         {
+            auto &element = mElements[i];
+            mIndices[element.Name] = i;
             element.Offset = align(mStride, element.BaseAlignment);
             mStride = element.Offset + (element.Count * align(element.Size, element.Count == 1 ? element.BaseAlignment : ShaderDataTypeAlignment(ShaderDataType::Vec4)));
         }
@@ -79,24 +83,80 @@ namespace Antomic
      * IndexBuffer Implementation
      *************************************************************/
 
-    Ref<IndexBuffer> IndexBuffer::Create(uint32_t *data, uint32_t size)
+    uint32_t IndexTypeSize(IndexType t)
+    {
+        switch (t)
+        {
+        case IndexType::UInt16:
+            return 2;
+        case IndexType::UInt32:
+            return 4;
+        }
+
+        ANTOMIC_ASSERT(false, "IndexType: Unknown index type")
+        return 0;
+    }
+
+    static std::vector<uint16_t> NarrowIndices(const uint32_t *data, uint32_t count)
+    {
+        std::vector<uint16_t> indices(count);
+        for (uint32_t i = 0; i < count; i++)
+        {
+            ANTOMIC_ASSERT(data[i] <= std::numeric_limits<uint16_t>::max(), "IndexBuffer: Index does not fit in 16 bits!")
+            indices[i] = (uint16_t)data[i];
+        }
+        return indices;
+    }
+
+    static Ref<IndexBuffer> CreateIndexBuffer(const void *data, uint32_t size, IndexType type)
     {
         switch (Platform::GetRenderAPIDialect())
         {
 #ifdef ANTOMIC_GL_RENDERER
         case RenderAPIDialect::OPENGL:
-            return CreateRef<OpenGLIndexBuffer>(data, size);
+            return CreateRef<OpenGLIndexBuffer>(data, size, type);
 #endif
         default:
-            return CreateRef<NullIndexBuffer>(data, size);
+            return CreateRef<NullIndexBuffer>(data, size, type);
+        }
+    }
+
+    Ref<IndexBuffer> IndexBuffer::Create(uint32_t *data, uint32_t size)
+    {
+        // Half the memory and fetch bandwidth when the vertices referenced
+        // are addressable with 16 bits
+        auto count = size / (uint32_t)sizeof(uint32_t);
+        if (std::all_of(data, data + count, [](uint32_t index) { return index <= std::numeric_limits<uint16_t>::max(); }))
+        {
+            auto indices = NarrowIndices(data, count);
+            return CreateIndexBuffer(indices.data(), count * (uint32_t)sizeof(uint16_t), IndexType::UInt16);
+        }
+        return CreateIndexBuffer(data, size, IndexType::UInt32);
+    }
+
+    Ref<IndexBuffer> IndexBuffer::Create(uint16_t *data, uint32_t size)
+    {
+        return CreateIndexBuffer(data, size, IndexType::UInt16);
+    }
+
+    void IndexBuffer::Upload(uint32_t *data, uint32_t size) const
+    {
+        if (mType == IndexType::UInt32)
+        {
+            SetData(data, size);
+            return;
         }
+
+        auto count = size / (uint32_t)sizeof(uint32_t);
+        auto indices = NarrowIndices(data, count);
+        SetData(indices.data(), count * (uint32_t)sizeof(uint16_t));
     }
 
     /*************************************************************
      * VertexBuffer Implementation
      *************************************************************/
 
-    Ref<VertexBuffer> VertexBuffer::Create(float *data, uint32_t size)
+    Ref<VertexBuffer> VertexBuffer::Create(const void *data, uint32_t size)
     {
         switch (Platform::GetRenderAPIDialect())
         {
@@ -109,6 +169,19 @@ namespace Antomic
         }
     }
 
+    Ref<VertexBuffer> VertexBuffer::Create(uint32_t size)
+    {
+        switch (Platform::GetRenderAPIDialect())
+        {
+#ifdef ANTOMIC_GL_RENDERER
+        case RenderAPIDialect::OPENGL:
+            return CreateRef<OpenGLVertexBuffer>(size);
+#endif
+        default:
+            return CreateRef<NullVertexBuffer>(size);
+        }
+    }
+
     /*************************************************************
      * UniformBuffer Implementation
      *************************************************************/
@@ -126,14 +199,107 @@ namespace Antomic
         }
     }
 
-    const UniformBufferElement &UniformBufferLayout::GetElement(const std::string &name)
+    const UniformBufferElement &UniformBufferLayout::GetElement(const std::string &name) const
     {
-        auto is_element = [&name](const UniformBufferElement &element) -> bool {
-            return element.Name.compare(name) == 0;
-        };
+        auto it = mIndices.find(name);
+        ANTOMIC_ASSERT(it != mIndices.end(), "UniformBufferLayout: Element does not exists!")
+        return mElements[it->second];
+    }
+
+    UniformBuffer::UniformBuffer(const UniformBufferLayout &layout)
+        : mLayout(layout), mData(layout.Stride(), 0)
+    {
+    }
+
+    void UniformBuffer::Write(const std::string &name, const void *data, uint32_t size)
+    {
+        const auto &element = mLayout.GetElement(name);
+        ANTOMIC_ASSERT(element.Offset + size <= mData.size(), "UniformBuffer: Value out of bounds!")
+        std::memcpy(mData.data() + element.Offset, data, size);
+        mDirtyRanges.push_back({element.Offset, element.Offset + size});
+    }
+
+    void UniformBuffer::SetValue(const std::string &name, const glm::mat4 &data)
+    {
+        Write(name, glm::value_ptr(data), sizeof(glm::mat4));
+    }
+
+    void UniformBuffer::SetValue(const std::string &name, const glm::mat3 &data)
+    {
+        // std140 stores each column as a vec4
+        glm::mat3x4 columns(glm::vec4(data[0], 0.0f), glm::vec4(data[1], 0.0f), glm::vec4(data[2], 0.0f));
+        Write(name, glm::value_ptr(columns), sizeof(glm::mat3x4));
+    }
+
+    void UniformBuffer::SetValue(const std::string &name, const glm::vec4 &data)
+    {
+        Write(name, glm::value_ptr(data), sizeof(glm::vec4));
+    }
+
+    void UniformBuffer::SetValue(const std::string &name, const glm::vec3 &data)
+    {
+        Write(name, glm::value_ptr(data), sizeof(glm::vec3));
+    }
+
+    void UniformBuffer::SetValue(const std::string &name, const glm::vec2 &data)
+    {
+        Write(name, glm::value_ptr(data), sizeof(glm::vec2));
+    }
+
+    void UniformBuffer::SetValue(const std::string &name, float data)
+    {
+        Write(name, &data, sizeof(float));
+    }
+
+    void UniformBuffer::SetValue(const std::string &name, uint32_t data)
+    {
+        Write(name, &data, sizeof(uint32_t));
+    }
+
+    void UniformBuffer::SetValue(const std::string &name, int data)
+    {
+        Write(name, &data, sizeof(int));
+    }
+
+    void UniformBuffer::SetValue(const std::string &name, bool data)
+    {
+        // std140 booleans take 4 bytes
+        uint32_t value = data ? 1 : 0;
+        Write(name, &value, sizeof(uint32_t));
+    }
+
+    uint32_t UniformBuffer::Flush()
+    {
+        if (mDirtyRanges.empty())
+        {
+            return 0;
+        }
+
+        // Ranges closer than this are sent together, re-sending a few clean
+        // bytes is cheaper than another upload
+        const uint32_t mergeDistance = 64;
+
+        std::sort(mDirtyRanges.begin(), mDirtyRanges.end());
+
+        uint32_t uploads = 0;
+        auto current = mDirtyRanges.front();
+        for (auto &range : mDirtyRanges)
+        {
+            if (range.first <= current.second + mergeDistance)
+            {
+                current.second = std::max(current.second, range.second);
+                continue;
+            }
+
+            Upload(current.first, current.second - current.first, mData.data() + current.first);
+            uploads++;
+            current = range;
+        }
+
+        Upload(current.first, current.second - current.first, mData.data() + current.first);
+        uploads++;
 
-        auto it = std::find_if(mElements.begin(), mElements.end(), is_element);
-        ANTOMIC_ASSERT(it!=mElements.end(),"UniformBufferLayout: Element does not exists!")
-        return *it;
+        mDirtyRanges.clear();
+        return uploads;
     }
 }
\ No newline at end of file
@@ -93,13 +93,14 @@ namespace Antomic
     public:
         inline const std::vector<UniformBufferElement> &Elements() const { return mElements; }
         inline uint32_t Stride() const { return mStride; }
-        const UniformBufferElement &GetElement(const std::string& name);
+        const UniformBufferElement &GetElement(const std::string& name) const;
 
     private:
         void Update();
 
     private:
         std::vector<UniformBufferElement> mElements;
+        std::unordered_map<std::string, size_t> mIndices;
         uint32_t mStride = 0;
     };
 
@@ -107,17 +108,40 @@ namespace Antomic
      * IndexBuffer Implementation
      *************************************************************/
 
+    enum class IndexType : uint8_t
+    {
+        UInt16,
+        UInt32
+    };
+
+    uint32_t IndexTypeSize(IndexType t);
+
     class IndexBuffer : public Bindable
     {
     public:
+        IndexBuffer(IndexType type, uint32_t count) : mType(type), mCount(count) {}
         virtual ~IndexBuffer() = default;
 
     public:
-        virtual void Upload(uint32_t *data, uint32_t size) const = 0;
-        virtual uint32_t Count() const = 0;
+        // Bound through the vertex array using it
+        virtual void Record(CommandBuffer &commands) const override {}
+
+        // Indices are narrowed when the buffer holds 16-bit indices
+        void Upload(uint32_t *data, uint32_t size) const;
+        inline uint32_t Count() const { return mCount; }
+        inline IndexType Type() const { return mType; }
+
+    protected:
+        virtual void SetData(const void *data, uint32_t size) const = 0;
+
+    private:
+        IndexType mType;
+        uint32_t mCount;
 
     public:
+        // 32-bit indices are stored in 16 bits when every index fits
         static Ref<IndexBuffer> Create(uint32_t *data, uint32_t size);
+        static Ref<IndexBuffer> Create(uint16_t *data, uint32_t size);
     };
 
     /*************************************************************
@@ -130,34 +154,58 @@ namespace Antomic
         virtual ~VertexBuffer() = default;
 
     public:
+        // Bound through the vertex array using it
+        virtual void Record(CommandBuffer &commands) const override {}
+
         virtual void Upload(uint32_t *data, uint32_t size) const = 0;
+        virtual void SetData(const void *data, uint32_t size) = 0;
         virtual const BufferLayout &Layout() const = 0;
         virtual void SetLayout(const BufferLayout &layout) = 0;
 
     public:
-        static Ref<VertexBuffer> Create(float *data, uint32_t size);
+        static Ref<VertexBuffer> Create(const void *data, uint32_t size);
+        static Ref<VertexBuffer> Create(uint32_t size);
     };
 
     /*************************************************************
      * UniformBuffer Implementation
      *************************************************************/
 
+    // Values are written to a std140 copy of the buffer on the CPU, the
+    // dirty ranges are merged and sent to the GPU on Flush
     class UniformBuffer 
     {
     public:
+        UniformBuffer(const UniformBufferLayout &layout);
         virtual ~UniformBuffer() = default;
 
     public:
-        virtual void SetValue(const std::string &name, const glm::mat4 &data) = 0;
-        virtual void SetValue(const std::string &name, const glm::mat3 &data) = 0;
-        virtual void SetValue(const std::string &name, const glm::vec4 &data) = 0;
-        virtual void SetValue(const std::string &name, const glm::vec3 &data) = 0;
-        virtual void SetValue(const std::string &name, const glm::vec2 &data) = 0;
-        virtual void SetValue(const std::string &name, float data ) = 0;
-        virtual void SetValue(const std::string &name, uint32_t data) = 0;
-        virtual void SetValue(const std::string &name, int data) = 0;
-        virtual void SetValue(const std::string &name, bool data) = 0;
-        virtual const UniformBufferLayout &Layout() const = 0;
+        void SetValue(const std::string &name, const glm::mat4 &data);
+        void SetValue(const std::string &name, const glm::mat3 &data);
+        void SetValue(const std::string &name, const glm::vec4 &data);
+        void SetValue(const std::string &name, const glm::vec3 &data);
+        void SetValue(const std::string &name, const glm::vec2 &data);
+        void SetValue(const std::string &name, float data );
+        void SetValue(const std::string &name, uint32_t data);
+        void SetValue(const std::string &name, int data);
+        void SetValue(const std::string &name, bool data);
+        inline const UniformBufferLayout &Layout() const { return mLayout; }
+
+        // Uploads the dirty ranges, returns the number of uploads issued
+        uint32_t Flush();
+        inline bool IsDirty() const { return !mDirtyRanges.empty(); }
+        inline const std::vector<uint8_t> &GetData() const { return mData; }
+
+    protected:
+        virtual void Upload(uint32_t offset, uint32_t size, const void *data) = 0;
+
+    private:
+        void Write(const std::string &name, const void *data, uint32_t size);
+
+    private:
+        UniformBufferLayout mLayout;
+        std::vector<uint8_t> mData;
+        std::vector<std::pair<uint32_t, uint32_t>> mDirtyRanges;
 
     public:
         static Ref<UniformBuffer> Create(const UniformBufferLayout &layout, uint32_t binding);
@@ -0,0 +1,93 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "Renderer/CommandBuffer.h"
+#include "Renderer/Buffers.h"
+#include "Renderer/VertexArray.h"
+
+namespace Antomic
+{
+    CommandBuffer::CommandBuffer(uint32_t capacity)
+    {
+        mData.reserve(capacity);
+    }
+
+    void CommandBuffer::SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+    {
+        auto &packet = Push<RenderCommands::SetViewport>();
+        packet.X = x;
+        packet.Y = y;
+        packet.Width = width;
+        packet.Height = height;
+    }
+
+    void CommandBuffer::SetClearColor(const glm::vec4 &color)
+    {
+        Push<RenderCommands::SetClearColor>().Color = color;
+    }
+
+    void CommandBuffer::Clear()
+    {
+        Push<RenderCommands::Clear>();
+    }
+
+    void CommandBuffer::BindShader(const Shader *shader)
+    {
+        Push<RenderCommands::BindShader>().Program = shader;
+    }
+
+    void CommandBuffer::BindTexture(const Texture *texture, uint32_t slot)
+    {
+        auto &packet = Push<RenderCommands::BindTexture>();
+        packet.Image = texture;
+        packet.Slot = slot;
+    }
+
+    void CommandBuffer::UpdateBuffer(const VertexBuffer *buffer, uint32_t offset, const void *data, uint32_t size)
+    {
+        auto &packet = Push<RenderCommands::UpdateBuffer>(size);
+        packet.Buffer = buffer;
+        packet.Offset = offset;
+        packet.DataSize = size;
+        WritePayload(packet, data, size);
+    }
+
+    void CommandBuffer::DrawIndexed(const Ref<VertexArray> &vertexArray, uint32_t indexCount, uint32_t baseVertex)
+    {
+        // The index type and count are resolved now so the backend does
+        // not have to
+        auto &packet = Push<RenderCommands::DrawIndexed>();
+        packet.Vertices = vertexArray.get();
+        packet.Indices = vertexArray->GetIndexBuffer()->Type();
+        packet.IndexCount = indexCount ? indexCount : vertexArray->GetIndexBuffer()->Count();
+        packet.BaseVertex = baseVertex;
+    }
+
+    void CommandBuffer::DrawIndexedInstanced(const Ref<VertexArray> &vertexArray, uint32_t instanceCount, uint32_t indexCount)
+    {
+        auto &packet = Push<RenderCommands::DrawIndexedInstanced>();
+        packet.Vertices = vertexArray.get();
+        packet.Indices = vertexArray->GetIndexBuffer()->Type();
+        packet.IndexCount = indexCount ? indexCount : vertexArray->GetIndexBuffer()->Count();
+        packet.InstanceCount = instanceCount;
+    }
+
+    void CommandBuffer::Reset()
+    {
+        mData.clear();
+        mCount = 0;
+    }
+
+} // namespace Antomic
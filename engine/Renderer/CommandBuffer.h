@@ -0,0 +1,225 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+#include "Core/Base.h"
+#include "Renderer/Buffers.h"
+#include "Renderer/Shader.h"
+#include "glm/glm.hpp"
+
+namespace Antomic
+{
+    enum class RenderCommandType : uint8_t
+    {
+        SET_VIEWPORT = 0,
+        SET_CLEAR_COLOR,
+        CLEAR,
+        BIND_SHADER,
+        BIND_TEXTURE,
+        SET_UNIFORM,
+        UPDATE_BUFFER,
+        DRAW_INDEXED,
+        DRAW_INDEXED_INSTANCED
+    };
+
+    // Every packet starts with a header, Size covers the header, the
+    // command and any data following it
+    struct RenderCommandHeader
+    {
+        RenderCommandType Type;
+        uint32_t Size;
+    };
+
+    /*************************************************************
+     * Command packets
+     *************************************************************/
+
+    // Packets are plain data, resources are referenced by pointer and
+    // must outlive the execution of the buffer recording them
+    namespace RenderCommands
+    {
+        struct SetViewport
+        {
+            static constexpr RenderCommandType Type = RenderCommandType::SET_VIEWPORT;
+            uint32_t X, Y, Width, Height;
+        };
+
+        struct SetClearColor
+        {
+            static constexpr RenderCommandType Type = RenderCommandType::SET_CLEAR_COLOR;
+            glm::vec4 Color;
+        };
+
+        struct Clear
+        {
+            static constexpr RenderCommandType Type = RenderCommandType::CLEAR;
+        };
+
+        struct BindShader
+        {
+            static constexpr RenderCommandType Type = RenderCommandType::BIND_SHADER;
+            const Shader *Program;
+        };
+
+        struct BindTexture
+        {
+            static constexpr RenderCommandType Type = RenderCommandType::BIND_TEXTURE;
+            const Texture *Image;
+            uint32_t Slot;
+        };
+
+        // Value of DataSize bytes follows the packet
+        struct SetUniform
+        {
+            static constexpr RenderCommandType Type = RenderCommandType::SET_UNIFORM;
+            const Shader *Program;
+            int32_t Location;
+            ShaderDataType DataType;
+            uint32_t DataSize;
+        };
+
+        // DataSize bytes follow the packet, written at Offset on execution.
+        // Only for buffers created with VertexBuffer::Create
+        struct UpdateBuffer
+        {
+            static constexpr RenderCommandType Type = RenderCommandType::UPDATE_BUFFER;
+            const VertexBuffer *Buffer;
+            uint32_t Offset;
+            uint32_t DataSize;
+        };
+
+        struct DrawIndexed
+        {
+            static constexpr RenderCommandType Type = RenderCommandType::DRAW_INDEXED;
+            const VertexArray *Vertices;
+            IndexType Indices;
+            uint32_t IndexCount;
+            uint32_t BaseVertex;
+        };
+
+        struct DrawIndexedInstanced
+        {
+            static constexpr RenderCommandType Type = RenderCommandType::DRAW_INDEXED_INSTANCED;
+            const VertexArray *Vertices;
+            IndexType Indices;
+            uint32_t IndexCount;
+            uint32_t InstanceCount;
+        };
+    } // namespace RenderCommands
+
+    /*************************************************************
+     * CommandBuffer Implementation
+     *************************************************************/
+
+    // Linear arena of command packets. Recording does not touch the render
+    // API, the buffer is executed later by the backend with
+    // RenderCommand::Execute, with no virtual call per command.
+    class CommandBuffer
+    {
+    public:
+        CommandBuffer(uint32_t capacity = 64 * 1024);
+        ~CommandBuffer() = default;
+
+    public:
+        // Recording operations
+        void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+        void SetClearColor(const glm::vec4 &color);
+        void Clear();
+        void BindShader(const Shader *shader);
+        void BindTexture(const Texture *texture, uint32_t slot = 0);
+        void UpdateBuffer(const VertexBuffer *buffer, uint32_t offset, const void *data, uint32_t size);
+        void DrawIndexed(const Ref<VertexArray> &vertexArray, uint32_t indexCount = 0, uint32_t baseVertex = 0);
+        void DrawIndexedInstanced(const Ref<VertexArray> &vertexArray, uint32_t instanceCount, uint32_t indexCount = 0);
+
+        template <typename T>
+        void SetUniform(const Ref<Shader> &shader, UniformHandle<T> handle, const T &value)
+        {
+            if (!handle.IsValid())
+            {
+                return;
+            }
+
+            auto &packet = Push<RenderCommands::SetUniform>(sizeof(T));
+            packet.Program = shader.get();
+            packet.Location = handle.GetLocation();
+            packet.DataType = ShaderDataTypeOf<T>::Value;
+            packet.DataSize = sizeof(T);
+            WritePayload(packet, &value, sizeof(T));
+        }
+
+        // Drops the recorded commands, keeping the memory
+        void Reset();
+
+        inline bool Empty() const { return mCount == 0; }
+        inline uint32_t GetCommandCount() const { return mCount; }
+        inline uint32_t GetSize() const { return (uint32_t)mData.size(); }
+
+        // Iteration, packets are read with GetCommand and the data
+        // following them with GetPayload
+        inline const RenderCommandHeader *Begin() const { return reinterpret_cast<const RenderCommandHeader *>(mData.data()); }
+        inline const RenderCommandHeader *End() const { return reinterpret_cast<const RenderCommandHeader *>(mData.data() + mData.size()); }
+
+        static inline const RenderCommandHeader *Next(const RenderCommandHeader *header)
+        {
+            return reinterpret_cast<const RenderCommandHeader *>(reinterpret_cast<const uint8_t *>(header) + header->Size);
+        }
+
+        template <typename T>
+        static inline const T &GetCommand(const RenderCommandHeader *header)
+        {
+            return *reinterpret_cast<const T *>(reinterpret_cast<const uint8_t *>(header) + PacketSize(sizeof(RenderCommandHeader)));
+        }
+
+        template <typename T>
+        static inline const void *GetPayload(const T *command)
+        {
+            return reinterpret_cast<const uint8_t *>(command) + PacketSize(sizeof(T));
+        }
+
+    private:
+        template <typename T>
+        T &Push(uint32_t payload = 0)
+        {
+            // Sizes are rounded so every packet starts aligned
+            auto size = PacketSize(sizeof(RenderCommandHeader)) + PacketSize(sizeof(T)) + PacketSize(payload);
+            auto offset = mData.size();
+            mData.resize(offset + size);
+
+            auto header = reinterpret_cast<RenderCommandHeader *>(mData.data() + offset);
+            header->Type = T::Type;
+            header->Size = size;
+            mCount++;
+
+            return *new (mData.data() + offset + PacketSize(sizeof(RenderCommandHeader))) T();
+        }
+
+        template <typename T>
+        static inline void WritePayload(T &command, const void *data, uint32_t size)
+        {
+            std::memcpy(reinterpret_cast<uint8_t *>(&command) + PacketSize(sizeof(T)), data, size);
+        }
+
+        static constexpr uint32_t PacketSize(size_t size)
+        {
+            return (uint32_t)((size + sPacketAlignment - 1) & ~(size_t)(sPacketAlignment - 1));
+        }
+
+    private:
+        static constexpr size_t sPacketAlignment = 8;
+        std::vector<uint8_t> mData;
+        uint32_t mCount = 0;
+    };
+
+} // namespace Antomic
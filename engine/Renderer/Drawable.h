@@ -16,6 +16,7 @@
 #pragma once
 #include "Core/Base.h"
 #include "Renderer/Material.h"
+#include "Renderer/Bounds.h"
 #include "glm/glm.hpp"
 
 namespace Antomic
@@ -38,11 +39,22 @@ namespace Antomic
         const glm::mat4 &GetModelMatrix() const { return mModelMatrix; }
         void SetModelMatrix(const glm::mat4 &matrix) { mModelMatrix = matrix; }
 
+        // Bounds in model space, drawables with unknown bounds are never culled
+        inline const BoundingBox &GetBounds() const { return mBounds; }
+        inline void SetBounds(const BoundingBox &bounds) { mBounds = bounds; }
+
+        // Sorting information used by the render queue
+        inline int GetZOrder() const { return mZOrder; }
+        inline void SetZOrder(int zorder) { mZOrder = zorder; }
+        virtual bool IsTranslucent() const { return false; }
+
         inline void AddBindable(const Ref<Bindable> &bindable) { mBindables.push_back(bindable); }
         inline const VectorRef<Bindable> &GetBindables() const { return mBindables; }
         
     private:
         VectorRef<Bindable> mBindables;
         glm::mat4 mModelMatrix;
+        BoundingBox mBounds = BoundingBox::Infinite();
+        int mZOrder = 0;
     };
 } // namespace Antomic
\ No newline at end of file
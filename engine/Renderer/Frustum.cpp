@@ -0,0 +1,78 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "Renderer/Frustum.h"
+
+namespace Antomic
+{
+    Frustum::Frustum(const glm::mat4 &projView)
+    {
+        // Rows of the matrix, planes point to the inside of the volume
+        glm::vec4 rows[4];
+        for (int i = 0; i < 4; i++)
+        {
+            rows[i] = glm::vec4(projView[0][i], projView[1][i], projView[2][i], projView[3][i]);
+        }
+
+        mPlanes[0] = rows[3] + rows[0];
+        mPlanes[1] = rows[3] - rows[0];
+        mPlanes[2] = rows[3] + rows[1];
+        mPlanes[3] = rows[3] - rows[1];
+        mPlanes[4] = rows[3] + rows[2];
+        mPlanes[5] = rows[3] - rows[2];
+
+        for (auto &plane : mPlanes)
+        {
+            plane /= glm::length(glm::vec3(plane));
+        }
+    }
+
+    FrustumTest Frustum::Test(const BoundingBox &box) const
+    {
+        if (box.IsEmpty())
+        {
+            return FrustumTest::OUTSIDE;
+        }
+
+        if (box.IsInfinite())
+        {
+            return FrustumTest::INTERSECT;
+        }
+
+        // Distance of the center against the projected radius of the box
+        auto center = box.GetCenter();
+        auto extents = box.GetExtents();
+        auto result = FrustumTest::INSIDE;
+        for (auto &plane : mPlanes)
+        {
+            auto normal = glm::vec3(plane);
+            auto distance = glm::dot(normal, center) + plane.w;
+            auto radius = glm::dot(glm::abs(normal), extents);
+
+            if (distance < -radius)
+            {
+                return FrustumTest::OUTSIDE;
+            }
+
+            if (distance < radius)
+            {
+                result = FrustumTest::INTERSECT;
+            }
+        }
+
+        return result;
+    }
+
+} // namespace Antomic
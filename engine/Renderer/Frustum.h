@@ -0,0 +1,50 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+#include "Core/Base.h"
+#include "Renderer/Bounds.h"
+#include "glm/glm.hpp"
+
+namespace Antomic
+{
+    enum class FrustumTest
+    {
+        OUTSIDE,
+        INTERSECT,
+        INSIDE
+    };
+
+    /*************************************************************
+     * Frustum Implementation
+     *************************************************************/
+
+    // Planes of the view volume, extracted from a projection * view matrix.
+    // The default frustum contains everything.
+    class Frustum
+    {
+    public:
+        Frustum() = default;
+        Frustum(const glm::mat4 &projView);
+
+    public:
+        FrustumTest Test(const BoundingBox &box) const;
+        inline const std::array<glm::vec4, 6> &GetPlanes() const { return mPlanes; }
+
+    private:
+        std::array<glm::vec4, 6> mPlanes = {};
+    };
+
+} // namespace Antomic
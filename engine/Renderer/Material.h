@@ -25,6 +25,14 @@ namespace Antomic
             virtual ~Material() = default;
 
         public:
-            virtual const Ref<Shader> &GetShader() const = 0;            
+            virtual const Ref<Shader> &GetShader() const = 0;
+            virtual void Record(CommandBuffer &commands) const override;
+
+            // Shader reading the model matrix from the instance buffer,
+            // materials without one are never drawn instanced
+            virtual const Ref<Shader> &GetInstancedShader() const { return mNoShader; }
+
+        private:
+            Ref<Shader> mNoShader = nullptr;
     };
 } //namespace Antomic
\ No newline at end of file
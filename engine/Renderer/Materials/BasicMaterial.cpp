@@ -14,12 +14,15 @@
    limitations under the License.
 */
 #include "Renderer/Materials/BasicMaterial.h"
+#include "Renderer/ResourceManager.h"
 
 namespace Antomic
 {
     BasicMaterial::BasicMaterial() 
     {
-        mShader = Shader::CreateFromFile("assets/shaders/materials/vs_basic.glsl", "assets/shaders/materials/fs_basic.glsl");
+        // Every basic material shares the same programs
+        mShader = ResourceManager::LoadShader("assets/shaders/materials/vs_basic.glsl", "assets/shaders/materials/fs_basic.glsl");
+        mInstancedShader = ResourceManager::LoadShader("assets/shaders/materials/vs_basic_instanced.glsl", "assets/shaders/materials/fs_basic.glsl");
     }
 
     void BasicMaterial::Bind() const
@@ -30,8 +30,10 @@ namespace Antomic
             virtual void Bind() const;
             virtual void Unbind() const { mShader->Unbind(); }
             virtual const Ref<Shader> &GetShader() const { return mShader; };
+            virtual const Ref<Shader> &GetInstancedShader() const { return mInstancedShader; };
         
         private:
             Ref<Shader> mShader;
+            Ref<Shader> mInstancedShader;
     };
 } //namespace Antomic
\ No newline at end of file
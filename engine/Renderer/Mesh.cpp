@@ -15,28 +15,91 @@
 */
 #include "Renderer/Mesh.h"
 #include "Renderer/Bindable.h"
+#include "Renderer/CommandBuffer.h"
 #include "Renderer/Shader.h"
 #include "Renderer/Texture.h"
 #include "Renderer/RenderCommand.h"
+#include "Renderer/Buffers.h"
+#include "Renderer/VertexArray.h"
+#include "Profiling/Instrumentor.h"
 
 namespace Antomic
 {
+    static const uint32_t sMaxInstances = 1024;
+    static CommandBuffer sImmediateCommands(1024);
+
     Mesh::Mesh(const Ref<VertexArray> &vertexArray, const Ref<Material> &material)
         : mVertexArray(vertexArray), mMaterial(material)
     {
+        mModelUniform = mMaterial->GetShader()->GetUniformHandle<glm::mat4>("m_model");
     }
 
     void Mesh::Draw()
     {
-        for (auto bindable : GetBindables())
+        sImmediateCommands.Reset();
+        Record(sImmediateCommands, GetModelMatrix());
+        RenderCommand::Execute(sImmediateCommands);
+    }
+
+    void Mesh::Record(CommandBuffer &commands, const glm::mat4 &model) const
+    {
+        for (auto &bindable : GetBindables())
+        {
+            bindable->Record(commands);
+        }
+
+        auto &shader = mMaterial->GetShader();
+        commands.SetUniform(shader, mModelUniform, model);
+        commands.BindShader(shader.get());
+        commands.DrawIndexed(mVertexArray);
+    }
+
+    void Mesh::RecordInstanced(CommandBuffer &commands, const Ref<Mesh> &mesh, const std::vector<glm::mat4> &models)
+    {
+        ANTOMIC_PROFILE_FUNCTION("Renderer");
+
+        if (models.empty())
+        {
+            return;
+        }
+
+        const auto &vertexArray = mesh->GetVertexArray();
+        const auto &shader = mesh->GetMaterial()->GetInstancedShader();
+
+        // Without an instanced shader there is nothing to gain
+        if (models.size() == 1 || shader == nullptr)
+        {
+            for (auto &model : models)
+            {
+                mesh->Record(commands, model);
+            }
+            return;
+        }
+
+        // The instance buffer is shared by every mesh using the vertex array
+        auto instanceBuffer = vertexArray->GetInstanceBuffer();
+        if (instanceBuffer == nullptr)
         {
-            bindable->Bind();
+            BufferLayout layout = {
+                {ShaderDataType::Mat4, "m_model"}};
+
+            instanceBuffer = VertexBuffer::Create(sMaxInstances * sizeof(glm::mat4));
+            instanceBuffer->SetLayout(layout);
+            vertexArray->SetInstanceBuffer(instanceBuffer);
+        }
+
+        for (auto &bindable : mesh->GetBindables())
+        {
+            bindable->Record(commands);
         }
+        commands.BindShader(shader.get());
 
-        auto shader = mMaterial->GetShader();
-        shader->SetUniformValue("m_model", GetModelMatrix());
-        shader->Bind();
-        RenderCommand::DrawIndexed(mVertexArray);
+        for (size_t start = 0; start < models.size(); start += sMaxInstances)
+        {
+            auto count = std::min<size_t>(sMaxInstances, models.size() - start);
+            commands.UpdateBuffer(instanceBuffer.get(), 0, &models[start], (uint32_t)(count * sizeof(glm::mat4)));
+            commands.DrawIndexedInstanced(vertexArray, (uint32_t)count);
+        }
     }
 
 } // namespace Antomic
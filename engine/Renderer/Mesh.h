@@ -16,6 +16,7 @@
 #pragma once
 #include "Core/Base.h"
 #include "Renderer/Drawable.h"
+#include "Renderer/Shader.h"
 #include "glm/glm.hpp"
 
 namespace Antomic
@@ -29,10 +30,19 @@ namespace Antomic
     public:
         virtual const DrawableType GetType() override { return DrawableType::MESH; }
         virtual void Draw() override;
-        
+        void Record(CommandBuffer &commands, const glm::mat4 &model) const;
+
+        inline const Ref<VertexArray> &GetVertexArray() const { return mVertexArray; }
+        inline const Ref<Material> &GetMaterial() const { return mMaterial; }
+
+    public:
+        // Records the mesh once per model matrix with one instanced draw
+        // call per instance buffer worth of matrices
+        static void RecordInstanced(CommandBuffer &commands, const Ref<Mesh> &mesh, const std::vector<glm::mat4> &models);
 
     private:
         Ref<VertexArray> mVertexArray;
         Ref<Material> mMaterial;
+        UniformHandle<glm::mat4> mModelUniform;
     };
 }
\ No newline at end of file
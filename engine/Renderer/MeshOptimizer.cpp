@@ -0,0 +1,350 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "enginepch.h"
+#include "Renderer/MeshOptimizer.h"
+#include "Core/Log.h"
+#include "Profiling/Instrumentor.h"
+
+namespace Antomic
+{
+    // Vertex entered the FIFO cache less than cacheSize misses ago
+    static inline bool IsCached(int64_t time, int64_t stamp, uint32_t cacheSize)
+    {
+        return time - stamp <= (int64_t)cacheSize;
+    }
+
+    VertexCacheStats MeshOptimizer::AnalyzeVertexCache(const std::vector<uint32_t> &indices, uint32_t vertexCount, uint32_t cacheSize)
+    {
+        VertexCacheStats stats;
+        auto triangleCount = (uint32_t)(indices.size() / 3);
+        if (triangleCount == 0)
+        {
+            return stats;
+        }
+
+        std::vector<int64_t> stamps(vertexCount, -(int64_t)cacheSize - 1);
+        std::vector<bool> referenced(vertexCount, false);
+        uint32_t unique = 0;
+        int64_t time = 0;
+        for (uint32_t i = 0; i < triangleCount * 3; i++)
+        {
+            auto vertex = indices[i];
+            if (!referenced[vertex])
+            {
+                referenced[vertex] = true;
+                unique++;
+            }
+
+            if (!IsCached(time, stamps[vertex], cacheSize))
+            {
+                stamps[vertex] = time++;
+            }
+        }
+
+        stats.Transformed = (uint32_t)time;
+        stats.ACMR = (float)stats.Transformed / triangleCount;
+        stats.ATVR = (float)stats.Transformed / unique;
+        return stats;
+    }
+
+    std::vector<uint32_t> MeshOptimizer::OptimizeVertexCache(const std::vector<uint32_t> &indices, uint32_t vertexCount,
+                                                             uint32_t cacheSize, std::vector<uint32_t> *clusters)
+    {
+        ANTOMIC_PROFILE_FUNCTION("Renderer");
+
+        // Sander, Nehab and Barczak, Fast Triangle Reordering for Vertex
+        // Locality and Reduced Overdraw, 2007
+        auto triangleCount = (uint32_t)(indices.size() / 3);
+        std::vector<uint32_t> result;
+        result.reserve(triangleCount * 3);
+        if (triangleCount == 0)
+        {
+            return result;
+        }
+
+        // Triangles using each vertex, packed per vertex
+        std::vector<uint32_t> live(vertexCount, 0);
+        for (uint32_t i = 0; i < triangleCount * 3; i++)
+        {
+            live[indices[i]]++;
+        }
+
+        std::vector<uint32_t> offsets(vertexCount + 1, 0);
+        for (uint32_t v = 0; v < vertexCount; v++)
+        {
+            offsets[v + 1] = offsets[v] + live[v];
+        }
+
+        std::vector<uint32_t> adjacency(offsets[vertexCount]);
+        std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+        for (uint32_t i = 0; i < triangleCount * 3; i++)
+        {
+            adjacency[fill[indices[i]]++] = i / 3;
+        }
+
+        std::vector<int64_t> stamps(vertexCount, 0);
+        std::vector<bool> emitted(triangleCount, false);
+        std::vector<uint32_t> deadEnds;
+        std::vector<uint32_t> candidates;
+        int64_t time = cacheSize + 1;
+        uint32_t cursor = 1;
+        int64_t fan = 0;
+        bool restarted = true;
+
+        while (fan >= 0)
+        {
+            if (restarted && clusters && (clusters->empty() || clusters->back() != result.size() / 3))
+            {
+                clusters->push_back((uint32_t)(result.size() / 3));
+            }
+
+            // Emit every triangle left around the fanning vertex
+            candidates.clear();
+            for (auto a = offsets[fan]; a < offsets[fan + 1]; a++)
+            {
+                auto triangle = adjacency[a];
+                if (emitted[triangle])
+                {
+                    continue;
+                }
+
+                for (uint32_t j = 0; j < 3; j++)
+                {
+                    auto vertex = indices[triangle * 3 + j];
+                    result.push_back(vertex);
+                    deadEnds.push_back(vertex);
+                    candidates.push_back(vertex);
+                    live[vertex]--;
+                    if (time - stamps[vertex] > (int64_t)cacheSize)
+                    {
+                        stamps[vertex] = time++;
+                    }
+                }
+                emitted[triangle] = true;
+            }
+
+            // Next fan is the oldest candidate that will still be in the
+            // cache once its triangles are emitted, or any one with triangles
+            int64_t best = -1;
+            int64_t bestPriority = -1;
+            for (auto vertex : candidates)
+            {
+                if (live[vertex] == 0)
+                {
+                    continue;
+                }
+
+                int64_t priority = 0;
+                if (time - stamps[vertex] + 2 * live[vertex] <= (int64_t)cacheSize)
+                {
+                    priority = time - stamps[vertex];
+                }
+
+                if (priority > bestPriority)
+                {
+                    best = vertex;
+                    bestPriority = priority;
+                }
+            }
+
+            restarted = best == -1;
+            if (!restarted)
+            {
+                fan = best;
+                continue;
+            }
+
+            // Dead end, go back to a recently used vertex or scan for one
+            fan = -1;
+            while (!deadEnds.empty() && fan == -1)
+            {
+                auto vertex = deadEnds.back();
+                deadEnds.pop_back();
+                if (live[vertex] > 0)
+                {
+                    fan = vertex;
+                }
+            }
+
+            while (cursor < vertexCount && fan == -1)
+            {
+                if (live[cursor] > 0)
+                {
+                    fan = cursor;
+                }
+                cursor++;
+            }
+        }
+
+        return result;
+    }
+
+    void MeshOptimizer::OptimizeOverdraw(std::vector<uint32_t> &indices, const std::vector<glm::vec3> &positions,
+                                         const std::vector<uint32_t> &clusters, uint32_t cacheSize, float threshold)
+    {
+        ANTOMIC_PROFILE_FUNCTION("Renderer");
+
+        auto triangleCount = (uint32_t)(indices.size() / 3);
+        if (triangleCount == 0)
+        {
+            return;
+        }
+
+        std::vector<uint32_t> hard(clusters);
+        if (hard.empty() || hard.front() != 0)
+        {
+            hard.insert(hard.begin(), 0);
+        }
+        hard.push_back(triangleCount);
+
+        // Soft boundaries, a cluster ends once its own ACMR, starting from an
+        // empty cache, is close enough to the one of the whole mesh
+        auto limit = threshold * AnalyzeVertexCache(indices, (uint32_t)positions.size(), cacheSize).ACMR;
+        std::vector<int64_t> stamps(positions.size(), -(int64_t)cacheSize - 1);
+        std::vector<uint32_t> starts;
+        int64_t time = 0;
+        for (size_t c = 0; c + 1 < hard.size(); c++)
+        {
+            starts.push_back(hard[c]);
+            time += cacheSize + 1;
+            uint32_t misses = 0;
+            uint32_t triangles = 0;
+            for (auto t = hard[c]; t < hard[c + 1]; t++)
+            {
+                for (uint32_t j = 0; j < 3; j++)
+                {
+                    auto vertex = indices[t * 3 + j];
+                    if (!IsCached(time, stamps[vertex], cacheSize))
+                    {
+                        stamps[vertex] = time++;
+                        misses++;
+                    }
+                }
+                triangles++;
+
+                if (t + 1 < hard[c + 1] && (float)misses / triangles <= limit)
+                {
+                    starts.push_back(t + 1);
+                    time += cacheSize + 1;
+                    misses = 0;
+                    triangles = 0;
+                }
+            }
+        }
+        starts.push_back(triangleCount);
+
+        // Area weighted centroids and normals, of the mesh and the clusters
+        struct Cluster
+        {
+            uint32_t Begin;
+            uint32_t End;
+            float Sort;
+        };
+
+        auto accumulate = [&](uint32_t begin, uint32_t end, glm::vec3 &centroid, glm::vec3 &normal) {
+            float area = 0.0f;
+            centroid = glm::vec3(0.0f);
+            normal = glm::vec3(0.0f);
+            glm::vec3 average(0.0f);
+            for (auto t = begin; t < end; t++)
+            {
+                auto &a = positions[indices[t * 3 + 0]];
+                auto &b = positions[indices[t * 3 + 1]];
+                auto &c = positions[indices[t * 3 + 2]];
+                auto cross = glm::cross(b - a, c - a);
+                auto weight = glm::length(cross);
+                centroid += (a + b + c) / 3.0f * weight;
+                average += (a + b + c) / 3.0f;
+                normal += cross;
+                area += weight;
+            }
+            centroid = area > 0.0f ? centroid / area : average / (float)(end - begin);
+        };
+
+        glm::vec3 meshCentroid, meshNormal;
+        accumulate(0, triangleCount, meshCentroid, meshNormal);
+
+        std::vector<Cluster> sorted;
+        sorted.reserve(starts.size() - 1);
+        for (size_t c = 0; c + 1 < starts.size(); c++)
+        {
+            glm::vec3 centroid, normal;
+            accumulate(starts[c], starts[c + 1], centroid, normal);
+            auto length = glm::length(normal);
+            auto sort = length > 0.0f ? glm::dot(centroid - meshCentroid, normal / length) : 0.0f;
+            sorted.push_back({starts[c], starts[c + 1], sort});
+        }
+
+        std::stable_sort(sorted.begin(), sorted.end(), [](const Cluster &a, const Cluster &b) { return a.Sort > b.Sort; });
+
+        std::vector<uint32_t> result;
+        result.reserve(indices.size());
+        for (auto &cluster : sorted)
+        {
+            result.insert(result.end(), indices.begin() + cluster.Begin * 3, indices.begin() + cluster.End * 3);
+        }
+        indices.swap(result);
+    }
+
+    uint32_t MeshOptimizer::OptimizeVertexFetch(std::vector<uint32_t> &indices, std::vector<uint8_t> &vertices, uint32_t stride)
+    {
+        ANTOMIC_PROFILE_FUNCTION("Renderer");
+
+        auto vertexCount = (uint32_t)(vertices.size() / stride);
+        std::vector<uint32_t> remap(vertexCount, std::numeric_limits<uint32_t>::max());
+        std::vector<uint8_t> result(vertices.size());
+        uint32_t next = 0;
+        for (auto &index : indices)
+        {
+            if (remap[index] == std::numeric_limits<uint32_t>::max())
+            {
+                std::memcpy(result.data() + (size_t)next * stride, vertices.data() + (size_t)index * stride, stride);
+                remap[index] = next++;
+            }
+            index = remap[index];
+        }
+
+        result.resize((size_t)next * stride);
+        vertices.swap(result);
+        return next;
+    }
+
+    MeshOptimizerReport MeshOptimizer::Optimize(std::vector<uint32_t> &indices, std::vector<uint8_t> &vertices, uint32_t stride,
+                                                uint32_t positionOffset, uint32_t cacheSize)
+    {
+        ANTOMIC_ASSERT(positionOffset + sizeof(glm::vec3) <= stride, "MeshOptimizer: Position outside of the vertex!");
+
+        MeshOptimizerReport report;
+        auto vertexCount = (uint32_t)(vertices.size() / stride);
+        std::vector<glm::vec3> positions(vertexCount);
+        for (uint32_t v = 0; v < vertexCount; v++)
+        {
+            std::memcpy(&positions[v], vertices.data() + (size_t)v * stride + positionOffset, sizeof(glm::vec3));
+        }
+
+        report.Before = AnalyzeVertexCache(indices, vertexCount, cacheSize);
+        report.VerticesBefore = vertexCount;
+
+        std::vector<uint32_t> clusters;
+        indices = OptimizeVertexCache(indices, vertexCount, cacheSize, &clusters);
+        OptimizeOverdraw(indices, positions, clusters, cacheSize);
+
+        report.VerticesAfter = OptimizeVertexFetch(indices, vertices, stride);
+        report.After = AnalyzeVertexCache(indices, report.VerticesAfter, cacheSize);
+        return report;
+    }
+
+} // namespace Antomic
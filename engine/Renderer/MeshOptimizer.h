@@ -0,0 +1,73 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+#include "Core/Base.h"
+#include "glm/glm.hpp"
+
+namespace Antomic
+{
+    // Post-transform vertex cache efficiency of an index buffer, simulated
+    // with a FIFO cache. ACMR is the vertices transformed per triangle, ATVR
+    // the vertices transformed per vertex referenced, 1 being the best.
+    struct VertexCacheStats
+    {
+        uint32_t Transformed = 0;
+        float ACMR = 0.0f;
+        float ATVR = 0.0f;
+    };
+
+    struct MeshOptimizerReport
+    {
+        VertexCacheStats Before;
+        VertexCacheStats After;
+        uint32_t VerticesBefore = 0;
+        uint32_t VerticesAfter = 0;
+    };
+
+    /*************************************************************
+     * MeshOptimizer Implementation
+     *************************************************************/
+
+    // Reorders the triangles and vertices of indexed triangle lists, meant
+    // to run once when meshes are imported or cooked, not at load time.
+    class MeshOptimizer
+    {
+    public:
+        static VertexCacheStats AnalyzeVertexCache(const std::vector<uint32_t> &indices, uint32_t vertexCount, uint32_t cacheSize = 16);
+
+        // Tipsify, fans triangles around the vertices still in the cache.
+        // Clusters receives the first triangle of every run that started
+        // after a dead end, the boundaries OptimizeOverdraw can move.
+        static std::vector<uint32_t> OptimizeVertexCache(const std::vector<uint32_t> &indices, uint32_t vertexCount,
+                                                         uint32_t cacheSize = 16, std::vector<uint32_t> *clusters = nullptr);
+
+        // Splits the clusters further while their ACMR stays under threshold
+        // times the mesh ACMR, then sorts them so the outward facing ones on
+        // the outside of the mesh are drawn first
+        static void OptimizeOverdraw(std::vector<uint32_t> &indices, const std::vector<glm::vec3> &positions,
+                                     const std::vector<uint32_t> &clusters, uint32_t cacheSize = 16, float threshold = 1.05f);
+
+        // Moves vertices in the order the indices first reference them and
+        // drops the unreferenced ones, returns the new vertex count
+        static uint32_t OptimizeVertexFetch(std::vector<uint32_t> &indices, std::vector<uint8_t> &vertices, uint32_t stride);
+
+        // Runs the three passes in order. Positions are read as three floats
+        // at positionOffset of every vertex.
+        static MeshOptimizerReport Optimize(std::vector<uint32_t> &indices, std::vector<uint8_t> &vertices, uint32_t stride,
+                                            uint32_t positionOffset = 0, uint32_t cacheSize = 16);
+    };
+
+} // namespace Antomic
@@ -0,0 +1,263 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "enginepch.h"
+#include "Renderer/OcclusionBuffer.h"
+#include "Core/WorkerPool.h"
+#include "Profiling/Instrumentor.h"
+
+namespace Antomic
+{
+    // Below this many rows per thread it is cheaper to stay serial
+    static const uint32_t sMinRowsPerThread = 16;
+
+    // Screen position and depth of a clip space position
+    static inline glm::vec3 ToScreen(const glm::vec4 &clip, uint32_t width, uint32_t height)
+    {
+        auto ndc = glm::vec3(clip) / clip.w;
+        return glm::vec3((ndc.x * 0.5f + 0.5f) * width, (0.5f - ndc.y * 0.5f) * height, ndc.z * 0.5f + 0.5f);
+    }
+
+    // Points in front of the near plane, the rest cannot be projected
+    static inline bool IsProjectable(const glm::vec4 &clip)
+    {
+        return clip.w > 0.0f && clip.z >= -clip.w;
+    }
+
+    OcclusionBuffer::OcclusionBuffer(uint32_t width, uint32_t height)
+        : mWidth(width), mHeight(height), mProjView(1.0f)
+    {
+        // Every level keeps the farthest depth of 2x2 texels of the one below
+        while (true)
+        {
+            mLevels.push_back({width, height, std::vector<float>(width * height, 1.0f)});
+            if (width == 1 && height == 1)
+            {
+                break;
+            }
+            width = std::max(1u, (width + 1) / 2);
+            height = std::max(1u, (height + 1) / 2);
+        }
+    }
+
+    void OcclusionBuffer::Begin(const glm::mat4 &projView)
+    {
+        mProjView = projView;
+        mOccluders.clear();
+        mTriangles.clear();
+        for (auto &level : mLevels)
+        {
+            std::fill(level.Depths.begin(), level.Depths.end(), 1.0f);
+        }
+    }
+
+    void OcclusionBuffer::AddOccluder(const Ref<Occluder> &occluder, const glm::mat4 &model)
+    {
+        mOccluders.push_back({occluder, model});
+    }
+
+    void OcclusionBuffer::Rasterize(uint32_t threads)
+    {
+        ANTOMIC_PROFILE_FUNCTION("Renderer");
+
+        SetupTriangles();
+        if (mTriangles.empty())
+        {
+            return;
+        }
+
+        // Pool threads own a band of rows each, there are no shared writes
+        threads = std::max(1u, std::min(threads, mHeight / sMinRowsPerThread));
+        WorkerPool::Get().ParallelFor(threads, [this, threads](uint32_t index) {
+            RasterizeRows(mHeight * index / threads, mHeight * (index + 1) / threads);
+        });
+
+        BuildHierarchy();
+    }
+
+    void OcclusionBuffer::SetupTriangles()
+    {
+        std::vector<glm::vec4> clip;
+        for (auto &[occluder, model] : mOccluders)
+        {
+            auto matrix = mProjView * model;
+            clip.resize(occluder->Positions.size());
+            for (size_t i = 0; i < clip.size(); i++)
+            {
+                clip[i] = matrix * glm::vec4(occluder->Positions[i], 1.0f);
+            }
+
+            // Triangles crossing the near plane are dropped, a missing
+            // occluder only makes the culling less effective
+            auto &indices = occluder->Indices;
+            for (size_t i = 0; i + 2 < indices.size(); i += 3)
+            {
+                auto &a = clip[indices[i]];
+                auto &b = clip[indices[i + 1]];
+                auto &c = clip[indices[i + 2]];
+                if (!IsProjectable(a) || !IsProjectable(b) || !IsProjectable(c))
+                {
+                    continue;
+                }
+
+                mTriangles.push_back({{ToScreen(a, mWidth, mHeight), ToScreen(b, mWidth, mHeight), ToScreen(c, mWidth, mHeight)}});
+            }
+        }
+    }
+
+    void OcclusionBuffer::RasterizeRows(uint32_t top, uint32_t bottom)
+    {
+        auto &depths = mLevels[0].Depths;
+        for (auto &triangle : mTriangles)
+        {
+            auto v0 = triangle.Vertices[0];
+            auto v1 = triangle.Vertices[1];
+            auto v2 = triangle.Vertices[2];
+
+            // Counter clockwise on screen, both faces are rasterized
+            auto area = (v1.x - v0.x) * (v2.y - v0.y) - (v1.y - v0.y) * (v2.x - v0.x);
+            if (area < 0.0f)
+            {
+                std::swap(v1, v2);
+                area = -area;
+            }
+
+            if (area < 1e-6f)
+            {
+                continue;
+            }
+
+            auto minX = std::max(0, (int)std::floor(std::min({v0.x, v1.x, v2.x})));
+            auto maxX = std::min((int)mWidth - 1, (int)std::ceil(std::max({v0.x, v1.x, v2.x})));
+            auto minY = std::max((int)top, (int)std::floor(std::min({v0.y, v1.y, v2.y})));
+            auto maxY = std::min((int)bottom - 1, (int)std::ceil(std::max({v0.y, v1.y, v2.y})));
+            if (minX > maxX || minY > maxY)
+            {
+                continue;
+            }
+
+            // Edge functions, sampled at pixel centers and stepped along the
+            // row. Rows start from an exact value so bands match a serial pass
+            auto edge = [](const glm::vec3 &a, const glm::vec3 &b, float x, float y) {
+                return (b.x - a.x) * (y - a.y) - (b.y - a.y) * (x - a.x);
+            };
+
+            float stepX[3] = {v1.y - v2.y, v2.y - v0.y, v0.y - v1.y};
+            auto startX = minX + 0.5f;
+
+            // Depth is affine in screen space
+            auto inverse = 1.0f / area;
+            auto z0 = v0.z * inverse;
+            auto z1 = v1.z * inverse;
+            auto z2 = v2.z * inverse;
+
+            for (auto y = minY; y <= maxY; y++)
+            {
+                auto centerY = y + 0.5f;
+                auto w0 = edge(v1, v2, startX, centerY);
+                auto w1 = edge(v2, v0, startX, centerY);
+                auto w2 = edge(v0, v1, startX, centerY);
+                auto line = &depths[y * mWidth];
+                for (auto x = minX; x <= maxX; x++)
+                {
+                    if (w0 >= 0.0f && w1 >= 0.0f && w2 >= 0.0f)
+                    {
+                        auto depth = w0 * z0 + w1 * z1 + w2 * z2;
+                        line[x] = std::min(line[x], depth);
+                    }
+                    w0 += stepX[0];
+                    w1 += stepX[1];
+                    w2 += stepX[2];
+                }
+            }
+        }
+    }
+
+    void OcclusionBuffer::BuildHierarchy()
+    {
+        for (size_t index = 1; index < mLevels.size(); index++)
+        {
+            auto &source = mLevels[index - 1];
+            auto &level = mLevels[index];
+            for (uint32_t y = 0; y < level.Height; y++)
+            {
+                auto y0 = std::min(y * 2, source.Height - 1);
+                auto y1 = std::min(y * 2 + 1, source.Height - 1);
+                for (uint32_t x = 0; x < level.Width; x++)
+                {
+                    auto x0 = std::min(x * 2, source.Width - 1);
+                    auto x1 = std::min(x * 2 + 1, source.Width - 1);
+                    level.Depths[y * level.Width + x] = std::max(
+                        std::max(source.Depths[y0 * source.Width + x0], source.Depths[y0 * source.Width + x1]),
+                        std::max(source.Depths[y1 * source.Width + x0], source.Depths[y1 * source.Width + x1]));
+                }
+            }
+        }
+    }
+
+    bool OcclusionBuffer::IsOccluded(const BoundingBox &box) const
+    {
+        if (mTriangles.empty() || box.IsEmpty() || box.IsInfinite())
+        {
+            return false;
+        }
+
+        // Screen rect and nearest depth of the box
+        auto minScreen = glm::vec3(std::numeric_limits<float>::max());
+        auto maxScreen = glm::vec3(-std::numeric_limits<float>::max());
+        for (int i = 0; i < 8; i++)
+        {
+            auto corner = glm::vec3(i & 1 ? box.Max.x : box.Min.x, i & 2 ? box.Max.y : box.Min.y, i & 4 ? box.Max.z : box.Min.z);
+            auto clip = mProjView * glm::vec4(corner, 1.0f);
+            if (!IsProjectable(clip))
+            {
+                return false;
+            }
+
+            auto screen = ToScreen(clip, mWidth, mHeight);
+            minScreen = glm::min(minScreen, screen);
+            maxScreen = glm::max(maxScreen, screen);
+        }
+
+        auto x0 = std::max(0, (int)std::floor(minScreen.x));
+        auto x1 = std::min((int)mWidth - 1, (int)std::floor(maxScreen.x));
+        auto y0 = std::max(0, (int)std::floor(minScreen.y));
+        auto y1 = std::min((int)mHeight - 1, (int)std::floor(maxScreen.y));
+        if (x0 > x1 || y0 > y1)
+        {
+            return false;
+        }
+
+        // Lowest level where the rect covers at most 2x2 texels
+        size_t index = 0;
+        while (index + 1 < mLevels.size() && ((x1 >> index) - (x0 >> index) > 1 || (y1 >> index) - (y0 >> index) > 1))
+        {
+            index++;
+        }
+
+        auto &level = mLevels[index];
+        auto farthest = 0.0f;
+        for (auto y = y0 >> index; y <= y1 >> index; y++)
+        {
+            for (auto x = x0 >> index; x <= x1 >> index; x++)
+            {
+                farthest = std::max(farthest, level.Depths[y * level.Width + x]);
+            }
+        }
+
+        return minScreen.z > farthest;
+    }
+
+} // namespace Antomic
@@ -0,0 +1,87 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+#include "Core/Base.h"
+#include "Renderer/Bounds.h"
+#include "glm/glm.hpp"
+
+namespace Antomic
+{
+    // Low detail geometry rasterized into the occlusion buffer, in model
+    // space. It must fit inside the mesh it stands for, otherwise it hides
+    // geometry that is visible.
+    struct Occluder
+    {
+        std::vector<glm::vec3> Positions;
+        std::vector<uint32_t> Indices;
+    };
+
+    /*************************************************************
+     * OcclusionBuffer Implementation
+     *************************************************************/
+
+    // Small CPU depth buffer, occluders are rasterized every frame and the
+    // bounds of the nodes are tested against a hierarchy of the farthest
+    // depths. Depths go from 0 at the near plane to 1 at the far plane.
+    class OcclusionBuffer
+    {
+    public:
+        OcclusionBuffer(uint32_t width = 256, uint32_t height = 128);
+        ~OcclusionBuffer() = default;
+
+    public:
+        // Frame operations, occluders are queued between Begin and Rasterize.
+        // Rasterize splits the rows in bands run on the worker pool.
+        void Begin(const glm::mat4 &projView);
+        void AddOccluder(const Ref<Occluder> &occluder, const glm::mat4 &model);
+        void Rasterize(uint32_t threads = 1);
+
+        // True when the box is behind the rasterized occluders
+        bool IsOccluded(const BoundingBox &box) const;
+
+        inline uint32_t GetWidth() const { return mWidth; }
+        inline uint32_t GetHeight() const { return mHeight; }
+        inline uint32_t GetOccluderCount() const { return (uint32_t)mOccluders.size(); }
+        inline float GetDepth(uint32_t x, uint32_t y) const { return mLevels[0].Depths[y * mWidth + x]; }
+
+    private:
+        struct Triangle
+        {
+            glm::vec3 Vertices[3];
+        };
+
+        struct Level
+        {
+            uint32_t Width;
+            uint32_t Height;
+            std::vector<float> Depths;
+        };
+
+    private:
+        void SetupTriangles();
+        void RasterizeRows(uint32_t top, uint32_t bottom);
+        void BuildHierarchy();
+
+    private:
+        uint32_t mWidth;
+        uint32_t mHeight;
+        glm::mat4 mProjView;
+        std::vector<std::pair<Ref<Occluder>, glm::mat4>> mOccluders;
+        std::vector<Triangle> mTriangles;
+        std::vector<Level> mLevels;
+    };
+
+} // namespace Antomic
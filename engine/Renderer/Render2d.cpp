@@ -14,21 +14,80 @@
    limitations under the License.
 */
 #include "Renderer/Render2d.h"
+#include "Core/Log.h"
 #include "Renderer/Buffers.h"
+#include "Renderer/CommandBuffer.h"
 #include "Renderer/Shader.h"
 #include "Renderer/RenderCommand.h"
 #include "Renderer/Sprite.h"
+#include "Renderer/StreamBuffer.h"
+#include "Renderer/Texture.h"
 #include "Renderer/VertexArray.h"
+#include <glm/gtc/packing.hpp>
 
 namespace Antomic
 {
     static Ref<VertexArray> sVertexArray = nullptr;
     static Ref<Shader> sShader = nullptr;
+    static UniformHandle<glm::mat4> sModelUniform;
+    static UniformHandle<glm::vec4> sColorUniform;
+    static UniformHandle<glm::vec4> sTexRectUniform;
+
+    /*************************************************************
+     * Batch data
+     *************************************************************/
+
+    // Color and texture coordinates are packed, normalized integers are
+    // expanded back to floats by the vertex fetch
+    struct SpriteVertex
+    {
+        glm::vec2 Position;
+        uint32_t Color;
+        uint32_t TexCoord;
+        float TexIndex;
+    };
+
+    static const uint32_t sMaxBatchSprites = 10000;
+    static const uint32_t sMaxBatchVertices = sMaxBatchSprites * 4;
+    static const uint32_t sMaxBatchIndices = sMaxBatchSprites * 6;
+    static const uint32_t sMaxBatchTextures = 16;
+    static const uint32_t sMaxFrameBatches = 4;
+
+    // Quad corners in sprite space, same unit quad used by sVertexArray
+    static const glm::vec4 sQuadPositions[4] = {
+        {0.0f, 0.0f, 0.0f, 1.0f},
+        {1.0f, 0.0f, 0.0f, 1.0f},
+        {1.0f, 1.0f, 0.0f, 1.0f},
+        {0.0f, 1.0f, 0.0f, 1.0f}};
+
+    static const glm::vec2 sQuadTexCoords[4] = {
+        {0.0f, 0.0f},
+        {1.0f, 0.0f},
+        {1.0f, 1.0f},
+        {0.0f, 1.0f}};
+
+    static Ref<VertexArray> sBatchVertexArray = nullptr;
+    static Ref<StreamBuffer> sBatchVertexBuffer = nullptr;
+    static Ref<VertexArray> sOverflowVertexArray = nullptr;
+    static Ref<VertexBuffer> sOverflowVertexBuffer = nullptr;
+    static Ref<Shader> sBatchShader = nullptr;
+    static Ref<Texture> sWhiteTexture = nullptr;
+    static std::vector<SpriteVertex> sBatchVertices;
+    static std::array<Ref<Texture>, sMaxBatchTextures> sBatchTextures;
+    static uint32_t sBatchTextureCount = 0;
+    static uint32_t sBatchIndexCount = 0;
+    static uint32_t sBatchStreamedBytes = 0;
+    static bool sBatchActive = false;
+    static CommandBuffer *sBatchCommands = nullptr;
+    static CommandBuffer sImmediateCommands(1024);
 
     void Render2d::Init()
     {
         sVertexArray = VertexArray::Create();
         sShader = Shader::CreateFromFile("assets/shaders/2d/vs_sprite.glsl", "assets/shaders/2d/fs_sprite.glsl");
+        sModelUniform = sShader->GetUniformHandle<glm::mat4>("m_model");
+        sColorUniform = sShader->GetUniformHandle<glm::vec4>("m_color");
+        sTexRectUniform = sShader->GetUniformHandle<glm::vec4>("m_texrect");
 
         // Vertices for our quad
         float vertices[] = {
@@ -56,34 +115,223 @@ namespace Antomic
         // Index buffer for the quad
         auto indexBuffer = IndexBuffer::Create(indices, sizeof(indices));
         sVertexArray->SetIndexBuffer(indexBuffer);
+
+        // Batch resources, a streaming vertex buffer with one region per
+        // frame in flight and a static index buffer with the indices of
+        // every quad
+        sBatchVertexArray = VertexArray::Create();
+        sBatchShader = Shader::CreateFromFile("assets/shaders/2d/vs_sprite_batch.glsl", "assets/shaders/2d/fs_sprite_batch.glsl");
+
+        BufferLayout batchLayout = {
+            {ShaderDataType::Vec2, "m_pos"},
+            {ShaderDataType::UByte4, "m_color", true},
+            {ShaderDataType::Short2, "m_tex", true},
+            {ShaderDataType::Float, "m_texindex"}};
+
+        sBatchVertexBuffer = StreamBuffer::Create(sMaxFrameBatches * sMaxBatchVertices * sizeof(SpriteVertex));
+        sBatchVertexBuffer->SetLayout(batchLayout);
+        sBatchVertexArray->AddVertexBuffer(sBatchVertexBuffer);
+
+        // Batches past what a region holds are copied with the commands,
+        // the driver orders the copies with the draws reading the buffer
+        sOverflowVertexArray = VertexArray::Create();
+        sOverflowVertexBuffer = VertexBuffer::Create(sMaxBatchVertices * sizeof(SpriteVertex));
+        sOverflowVertexBuffer->SetLayout(batchLayout);
+        sOverflowVertexArray->AddVertexBuffer(sOverflowVertexBuffer);
+
+        std::vector<uint32_t> batchIndices(sMaxBatchIndices);
+        for (uint32_t i = 0, vertex = 0; i < sMaxBatchIndices; i += 6, vertex += 4)
+        {
+            batchIndices[i + 0] = vertex + 0;
+            batchIndices[i + 1] = vertex + 1;
+            batchIndices[i + 2] = vertex + 2;
+            batchIndices[i + 3] = vertex + 2;
+            batchIndices[i + 4] = vertex + 3;
+            batchIndices[i + 5] = vertex + 0;
+        }
+
+        auto batchIndexBuffer = IndexBuffer::Create(batchIndices.data(), sMaxBatchIndices * sizeof(uint32_t));
+        sBatchVertexArray->SetIndexBuffer(batchIndexBuffer);
+        sOverflowVertexArray->SetIndexBuffer(batchIndexBuffer);
+
+        // Sprites without texture sample from slot 0
+        unsigned char white[4] = {255, 255, 255, 255};
+        sWhiteTexture = Texture::CreateTexture(TextureSpecification(), white);
+
+        sBatchVertices.reserve(sMaxBatchVertices);
+        sBatchTextures[0] = sWhiteTexture;
+        sBatchTextureCount = 1;
     }
 
-    void Render2d::DrawSprite(const Ref<Sprite> &sprite)
+    void Render2d::BeginBatch(CommandBuffer &commands)
+    {
+        ANTOMIC_ASSERT(!sBatchActive, "Render2d: Batch already started!");
+        sBatchActive = true;
+        sBatchCommands = &commands;
+        sBatchVertices.clear();
+        sBatchIndexCount = 0;
+        sBatchTextureCount = 1;
+        sBatchStreamedBytes = 0;
+    }
+
+    void Render2d::EndBatch()
+    {
+        ANTOMIC_ASSERT(sBatchActive, "Render2d: Batch not started!");
+        Flush();
+        sBatchActive = false;
+        sBatchCommands = nullptr;
+    }
+
+    void Render2d::EndFrame()
+    {
+        // Next frame writes to a region the GPU is not reading, the fence
+        // has to come after the draws reading the current one
+        sBatchVertexBuffer->Advance();
+    }
+
+    uint32_t Render2d::GetStreamedBytes()
     {
-        sShader->SetUniformValue("m_model", sprite->GetModelMatrix());
-        sShader->SetUniformValue("m_color", sprite->GetSpriteColor());
-        sShader->Bind();
-        for (auto bindable : sprite->GetBindables())
+        return sBatchStreamedBytes;
+    }
+
+    void Render2d::Flush()
+    {
+        if (sBatchIndexCount == 0)
+        {
+            return;
+        }
+
+        // Vertex data is aligned to the vertex size so the draw can start
+        // on the allocation with a base vertex. The region is only fenced
+        // at the end of the frame, once the draws reading it are submitted.
+        auto size = (uint32_t)(sBatchVertices.size() * sizeof(SpriteVertex));
+        auto allocation = sBatchVertexBuffer->Allocate(size, sizeof(SpriteVertex));
+        auto vertexArray = sBatchVertexArray;
+        uint32_t baseVertex = 0;
+        if (allocation.Data != nullptr)
+        {
+            std::memcpy(allocation.Data, sBatchVertices.data(), size);
+            baseVertex = allocation.Offset / sizeof(SpriteVertex);
+            sBatchStreamedBytes += size;
+        }
+        else
         {
-            bindable->Bind();
+            sBatchCommands->UpdateBuffer(sOverflowVertexBuffer.get(), 0, sBatchVertices.data(), size);
+            vertexArray = sOverflowVertexArray;
         }
-        RenderCommand::DrawIndexed(sVertexArray);
+
+        sBatchCommands->BindShader(sBatchShader.get());
+        for (uint32_t slot = 0; slot < sBatchTextureCount; slot++)
+        {
+            sBatchCommands->BindTexture(sBatchTextures[slot].get(), slot);
+        }
+
+        sBatchCommands->DrawIndexed(vertexArray, sBatchIndexCount, baseVertex);
+
+        // Reset the batch, keeping the white texture on slot 0
+        sBatchVertices.clear();
+        sBatchIndexCount = 0;
+        for (uint32_t slot = 1; slot < sBatchTextureCount; slot++)
+        {
+            sBatchTextures[slot] = nullptr;
+        }
+        sBatchTextureCount = 1;
+    }
+
+    void Render2d::BatchSprite(const Sprite &sprite)
+    {
+        if (sBatchIndexCount >= sMaxBatchIndices)
+        {
+            Flush();
+        }
+
+        // Find the texture slot, if the texture is not on the batch yet and
+        // all slots are taken we need to flush first
+        float texIndex = 0.0f;
+        const auto &texture = sprite.GetTexture();
+        if (texture != nullptr)
+        {
+            uint32_t slot = 1;
+            while (slot < sBatchTextureCount && sBatchTextures[slot] != texture)
+            {
+                slot++;
+            }
+
+            if (slot == sMaxBatchTextures)
+            {
+                Flush();
+                slot = 1;
+            }
+
+            if (slot == sBatchTextureCount)
+            {
+                sBatchTextures[slot] = texture;
+                sBatchTextureCount++;
+            }
+
+            texIndex = (float)slot;
+        }
+
+        // Vertices are sent already transformed by the sprite model matrix
+        const auto &model = sprite.GetModelMatrix();
+        auto color = glm::packUnorm4x8(sprite.GetSpriteColor());
+        const auto &rect = sprite.GetTextureRect();
+        auto uvOffset = glm::vec2(rect.x, rect.y);
+        auto uvSize = glm::vec2(rect.z - rect.x, rect.w - rect.y);
+        for (uint32_t i = 0; i < 4; i++)
+        {
+            auto texCoord = glm::packSnorm2x16(uvOffset + sQuadTexCoords[i] * uvSize);
+            sBatchVertices.push_back({glm::vec2(model * sQuadPositions[i]), color, texCoord, texIndex});
+        }
+
+        sBatchIndexCount += 6;
+    }
+
+    void Render2d::DrawSprite(const Ref<Sprite> &sprite)
+    {
+        DrawSprite(*sprite);
     }
 
     void Render2d::DrawSprite(const Sprite &sprite)
     {
-        sShader->SetUniformValue("m_model", sprite.GetModelMatrix());
-        sShader->SetUniformValue("m_color", sprite.GetSpriteColor());
-        sShader->Bind();
-        for (auto bindable : sprite.GetBindables())
+        // The batch shader knows nothing about extra bindables, those
+        // sprites are drawn on their own between the batches around them
+        if (sBatchActive && sprite.GetBindables().empty())
+        {
+            BatchSprite(sprite);
+            return;
+        }
+
+        if (sBatchActive)
+        {
+            Flush();
+            RecordSprite(*sBatchCommands, sprite);
+            return;
+        }
+
+        sImmediateCommands.Reset();
+        RecordSprite(sImmediateCommands, sprite);
+        RenderCommand::Execute(sImmediateCommands);
+    }
+
+    void Render2d::RecordSprite(CommandBuffer &commands, const Sprite &sprite)
+    {
+        commands.SetUniform(sShader, sModelUniform, sprite.GetModelMatrix());
+        commands.SetUniform(sShader, sColorUniform, sprite.GetSpriteColor());
+        commands.SetUniform(sShader, sTexRectUniform, sprite.GetTextureRect());
+        commands.BindShader(sShader.get());
+        // Sprites still loading their texture draw with the white placeholder
+        auto &texture = sprite.GetTexture() != nullptr ? sprite.GetTexture() : sWhiteTexture;
+        texture->Record(commands);
+        for (auto &bindable : sprite.GetBindables())
         {
-            bindable->Bind();
+            bindable->Record(commands);
         }
-        RenderCommand::DrawIndexed(sVertexArray);
+        commands.DrawIndexed(sVertexArray);
     }
 
     void Render2d::Shutdown()
     {
         // For now we do nothing
     }
-}
\ No newline at end of file
+}
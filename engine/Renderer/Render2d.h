@@ -25,7 +25,24 @@ namespace Antomic
         static void Init();
         static void Shutdown();
 
+        // Batch operations, while a batch is open sprites are accumulated
+        // and recorded with one draw call per set of textures. EndFrame is
+        // called once the recorded commands were executed.
+        static void BeginBatch(CommandBuffer &commands);
+        static void EndBatch();
+        static void EndFrame();
+
+        // Vertex bytes streamed by the batches since BeginBatch, batches
+        // over the frame budget are counted with their copy commands
+        static uint32_t GetStreamedBytes();
+
+        // Sprites with bindables of their own are never batched
         static void DrawSprite(const Ref<Sprite> &sprite);
         static void DrawSprite(const Sprite &sprite);
+
+    private:
+        static void BatchSprite(const Sprite &sprite);
+        static void RecordSprite(CommandBuffer &commands, const Sprite &sprite);
+        static void Flush();
     };
 }
\ No newline at end of file
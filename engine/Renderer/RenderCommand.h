@@ -25,6 +25,9 @@ namespace Antomic
         inline static void SetViewport(const uint32_t &x, const uint32_t &y, uint32_t const &width, uint32_t const &height) { Platform::GetRenderAPI()->SetViewport(x, y, width, height); }
         inline static void SetClearColor(glm::vec4 color) { Platform::GetRenderAPI()->SetClearColor(color); }
         inline static void Clear() { Platform::GetRenderAPI()->Clear(); }
-        inline static void DrawIndexed(const Ref<VertexArray> vertexArray) { Platform::GetRenderAPI()->DrawIndexed(vertexArray); };
+        inline static void DrawIndexed(const Ref<VertexArray> vertexArray, uint32_t indexCount = 0, uint32_t baseVertex = 0) { Platform::GetRenderAPI()->DrawIndexed(vertexArray, indexCount, baseVertex); };
+        inline static void DrawIndexedInstanced(const Ref<VertexArray> vertexArray, uint32_t instanceCount, uint32_t indexCount = 0) { Platform::GetRenderAPI()->DrawIndexedInstanced(vertexArray, instanceCount, indexCount); };
+        inline static void Execute(const CommandBuffer &commands) { Platform::GetRenderAPI()->Execute(commands); }
+        inline static void CollectReleased() { Platform::GetRenderAPI()->CollectReleased(); }
     };
 } // namespace Antomic
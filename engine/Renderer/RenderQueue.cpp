@@ -0,0 +1,117 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "Renderer/RenderQueue.h"
+#include "Profiling/Instrumentor.h"
+
+namespace Antomic
+{
+    /*************************************************************
+     * RenderKey Implementation
+     *************************************************************/
+
+    static inline uint64_t EncodeZOrder(int zorder)
+    {
+        // Bias the z-order so negative values sort first
+        const uint32_t zorderMax = (1u << RenderKey::ZOrderBits) - 1;
+        auto biased = (int64_t)zorder + (1 << (RenderKey::ZOrderBits - 1));
+        return (uint64_t)std::clamp<int64_t>(biased, 0, zorderMax);
+    }
+
+    uint64_t RenderKey::Encode(RenderLayer layer, int zorder, bool translucent, uint32_t shader, uint32_t texture, float depth)
+    {
+        const uint32_t stateMax = (1u << StateBits) - 1;
+        const uint32_t depthMax = (1u << DepthBits) - 1;
+
+        uint64_t z = EncodeZOrder(zorder);
+
+        // Positive floats keep their order when compared as integers, we
+        // keep the upper bits of the representation below the sign
+        uint32_t bits = 0;
+        depth = std::max(depth, 0.0f);
+        std::memcpy(&bits, &depth, sizeof(bits));
+        uint64_t d = bits >> (31 - DepthBits);
+
+        uint64_t state = ((uint64_t)std::min(shader, stateMax) << StateBits) | std::min(texture, stateMax);
+
+        uint64_t key = (uint64_t)layer << 62;
+        key |= z << 46;
+        if (translucent)
+        {
+            key |= 1ull << 45;
+            key |= (depthMax - d) << (2 * StateBits);
+            key |= state;
+        }
+        else
+        {
+            key |= state << DepthBits;
+            key |= d;
+        }
+        return key;
+    }
+
+    uint64_t RenderKey::EncodeScreen(int zorder, uint64_t order)
+    {
+        const uint64_t orderMax = (1ull << 46) - 1;
+        return ((uint64_t)RenderLayer::SCREEN << 62) | (EncodeZOrder(zorder) << 46) | std::min(order, orderMax);
+    }
+
+    /*************************************************************
+     * RenderQueue Implementation
+     *************************************************************/
+
+    void RenderQueue::Sort()
+    {
+        ANTOMIC_PROFILE_FUNCTION("Renderer");
+
+        if (mItems.empty())
+        {
+            return;
+        }
+
+        mScratch.resize(mItems.size());
+
+        // One pass per key byte, passes where every key has the same byte
+        // are skipped as they would not change the order
+        for (uint32_t shift = 0; shift < 64; shift += 8)
+        {
+            std::array<uint32_t, 256> counts = {};
+            for (auto &item : mItems)
+            {
+                counts[(item.Key >> shift) & 0xff]++;
+            }
+
+            if (counts[(mItems.front().Key >> shift) & 0xff] == mItems.size())
+            {
+                continue;
+            }
+
+            uint32_t offset = 0;
+            for (auto &count : counts)
+            {
+                auto current = count;
+                count = offset;
+                offset += current;
+            }
+
+            for (auto &item : mItems)
+            {
+                mScratch[counts[(item.Key >> shift) & 0xff]++] = item;
+            }
+            mItems.swap(mScratch);
+        }
+    }
+
+} // namespace Antomic
@@ -0,0 +1,80 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+#include "Core/Base.h"
+
+namespace Antomic
+{
+    /*************************************************************
+     * RenderKey Implementation
+     *************************************************************/
+
+    // 64 bit sort key, from the most to the least significant bits:
+    //   layer (2) | z-order (16) | translucent (1) | shader (12) | texture (12) | depth (21)
+    // Translucent items swap depth and state to be drawn back to front.
+    // Screen items have no depth test, their keys keep the submission
+    // order right below the z-order whatever their state:
+    //   layer (2) | z-order (16) | order (46)
+    enum class RenderLayer : uint8_t
+    {
+        WORLD = 0,
+        SCREEN = 1
+    };
+
+    struct RenderKey
+    {
+        static const uint32_t ZOrderBits = 16;
+        static const uint32_t StateBits = 12;
+        static const uint32_t DepthBits = 21;
+
+        static uint64_t Encode(RenderLayer layer, int zorder, bool translucent, uint32_t shader, uint32_t texture, float depth);
+        static uint64_t EncodeScreen(int zorder, uint64_t order);
+        static RenderLayer GetLayer(uint64_t key) { return (RenderLayer)(key >> 62); }
+    };
+
+    /*************************************************************
+     * RenderQueue Implementation
+     *************************************************************/
+
+    struct RenderQueueItem
+    {
+        uint64_t Key;
+        uint32_t Index;
+    };
+
+    class RenderQueue
+    {
+    public:
+        RenderQueue() = default;
+        ~RenderQueue() = default;
+
+    public:
+        inline void Push(uint64_t key, uint32_t index) { mItems.push_back({key, index}); }
+        inline void Clear() { mItems.clear(); }
+        inline size_t Size() const { return mItems.size(); }
+        inline bool Empty() const { return mItems.empty(); }
+
+        // Stable LSD radix sort on the keys
+        void Sort();
+
+        inline const std::vector<RenderQueueItem> &GetItems() const { return mItems; }
+
+    private:
+        std::vector<RenderQueueItem> mItems;
+        std::vector<RenderQueueItem> mScratch;
+    };
+
+} // namespace Antomic
@@ -21,6 +21,7 @@
 #include "Renderer/Drawable.h"
 #include "Renderer/RendererFrame.h"
 #include "Renderer/RendererWorker.h"
+#include "Renderer/TextureLoader.h"
 #include "Renderer/Buffers.h"
 #include "Graph/Scene.h"
 #include "Profiling/Instrumentor.h"
@@ -30,6 +31,8 @@ namespace Antomic
 {
     Renderer::Renderer(const RendererViewport &viewport)
     {
+        mLastFrameTime = 0;
+
         {
             UniformBufferLayout cameraBufferLayout = {
                 {ShaderDataType::Mat4, "m_proj"},
@@ -46,7 +49,9 @@ namespace Antomic
 
     Renderer::~Renderer()
     {
+        TextureLoader::Get().Shutdown();
         Render2d::Shutdown();
+        RenderCommand::CollectReleased();
     }
 
     const Ref<Scene> &Renderer::GetCurrentScene()
@@ -70,11 +75,25 @@ namespace Antomic
     {
         ANTOMIC_PROFILE_FUNCTION("Renderer");
 
+        auto frame = BuildFrame();
+        if (frame != nullptr)
+        {
+            SubmitFrame(frame);
+        }
+    }
+
+    Ref<RendererFrame> Renderer::BuildFrame()
+    {
+        ANTOMIC_PROFILE_FUNCTION("Renderer");
+
         if (mScene == nullptr)
         {
-            return;
+            return nullptr;
         }
 
+        // Hand the textures uploaded by the render thread to the scene
+        TextureLoader::Get().Dispatch();
+
         // Get the time passed since last frame
         auto currentTime = Platform::GetCurrentTick();
 
@@ -84,29 +103,65 @@ namespace Antomic
         mLastFrameTime = currentTime;
         mScene->Update((uint32_t) timestep);
 
-        // Get View matrices
-        auto viewMatrix = mScene->GetViewMatrix();
-        auto projView = mProjectionMatrix * viewMatrix;
+        // Create a new frame
+        auto frame = CreateRef<RendererFrame>(mViewport, mScene->GetViewMatrix());
+        frame->SetProjection(mProjectionMatrix, mOrthoMatrix);
+        frame->SetFrustum(Frustum(mProjectionMatrix * frame->GetViewMatrix()));
+
+        // Ask scene to submit drawables to this frame, sorting it here
+        // leaves the render thread with only the submission
+        mScene->SubmitDrawables(frame);
+        frame->Sort();
+
+        return frame;
+    }
+
+    void Renderer::SubmitFrame(const Ref<RendererFrame> &frame)
+    {
+        ANTOMIC_PROFILE_FUNCTION("Renderer");
+
+        // Objects the main thread let go of since the last frame
+        RenderCommand::CollectReleased();
 
         // Update the values on our camera uniform
+        auto &viewMatrix = frame->GetViewMatrix();
+        mCameraBuffer->SetValue("m_proj", frame->GetProjectionMatrix());
         mCameraBuffer->SetValue("m_view", viewMatrix);
-        mCameraBuffer->SetValue("m_projview", projView);
+        mCameraBuffer->SetValue("m_projview", frame->GetProjectionMatrix() * viewMatrix);
+        mCameraBuffer->SetValue("m_ortho", frame->GetOrthoMatrix());
 
-        // Create a new frame
-        auto frame = CreateRef<RendererFrame>(mViewport, viewMatrix);
+        // Send the camera values changed since last frame in one go
+        frame->GetStats().UniformUploads += mCameraBuffer->Flush();
 
-        // Ask scene to submit drawables to this frame
-        mScene->SubmitDrawables(frame);
+        // Pending texture uploads, within the per frame budget
+        TextureLoader::Get().Upload();
 
         // Start the rendering process
         frame->Draw();
-        mLastFrame = frame;
+        {
+            std::lock_guard<std::mutex> lock(mLastFrameMutex);
+            mLastFrame = frame;
+            mLastFrameStats = frame->GetStats();
+        }
         Platform::SwapBuffer();
     }
 
+    const Ref<RendererFrame> Renderer::GetLastFrame() const
+    {
+        std::lock_guard<std::mutex> lock(mLastFrameMutex);
+        return mLastFrame;
+    }
+
+    RendererStats Renderer::GetLastFrameStats() const
+    {
+        std::lock_guard<std::mutex> lock(mLastFrameMutex);
+        return mLastFrameStats;
+    }
+
     const uint64_t Renderer::GetLastFrameTime()
     {
-        if (mLastFrame == nullptr)
+        // The last frame is owned by the render thread, the time is not
+        if (mLastFrameTime == 0)
         {
             return Platform::GetCurrentTick();
         }
@@ -119,19 +174,19 @@ namespace Antomic
         if (mScene == nullptr)
         {
             mProjectionMatrix = glm::mat4(1.0f);
+            mOrthoMatrix = glm::mat4(1.0f);
             return;
         }
         auto active = mScene->GetActiveCamera();
         ANTOMIC_ASSERT(active != nullptr, "Renderer: Scene without active camera!")
         mProjectionMatrix = active->GetProjectionMatrix(mViewport);
-        mCameraBuffer->SetValue("m_proj", mProjectionMatrix);
         switch (active->GetType())
         {
         case CameraType::ORTOGRAPHIC:
-            mCameraBuffer->SetValue("m_ortho", mProjectionMatrix);
+            mOrthoMatrix = mProjectionMatrix;
             return;
         default:
-            mCameraBuffer->SetValue("m_ortho", OrthographicCamera::ProjectionMatrix(mViewport));
+            mOrthoMatrix = OrthographicCamera::ProjectionMatrix(mViewport);
             return;
         }
     }
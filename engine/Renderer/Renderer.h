@@ -15,6 +15,7 @@
 */
 #pragma once
 #include "Core/Base.h"
+#include "Renderer/RendererStats.h"
 #include "glm/glm.hpp"
 
 namespace Antomic
@@ -52,9 +53,15 @@ namespace Antomic
         inline const RendererViewport &GetViewport() const { return mViewport; }
         void SetViewport(const RendererViewport &viewport);
 
-        // Frame Operations
+        // Frame Operations, BuildFrame runs on the main thread and
+        // SubmitFrame on the thread owning the render context
         void RenderFrame();
-        inline const Ref<RendererFrame> GetLastFrame() const { return mLastFrame; }
+        Ref<RendererFrame> BuildFrame();
+        void SubmitFrame(const Ref<RendererFrame> &frame);
+        // Safe from any thread, the frame is no longer changed once drawn
+        const Ref<RendererFrame> GetLastFrame() const;
+        // Copy of the counters of the last frame drawn, safe from any thread
+        RendererStats GetLastFrameStats() const;
         const uint64_t GetLastFrameTime();
 
     private:
@@ -62,10 +69,13 @@ namespace Antomic
 
     private:
         Ref<RendererFrame> mLastFrame;
+        RendererStats mLastFrameStats;
+        mutable std::mutex mLastFrameMutex;
         uint64_t mLastFrameTime;
         Ref<Scene> mScene;
         RendererViewport mViewport;
         glm::mat4 mProjectionMatrix;
+        glm::mat4 mOrthoMatrix;
         Ref<UniformBuffer> mCameraBuffer;
     };
 } // namespace Antomic
\ No newline at end of file
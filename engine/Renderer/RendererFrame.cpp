@@ -15,24 +15,36 @@
 */
 #include "Renderer/RendererFrame.h"
 #include "Renderer/Renderer.h"
+#include "Renderer/CommandBuffer.h"
 #include "Renderer/Drawable.h"
+#include "Renderer/Mesh.h"
+#include "Renderer/Render2d.h"
+#include "Renderer/Sprite.h"
 #include "RenderCommand.h"
 #include "Core/Log.h"
 #include "Profiling/Instrumentor.h"
 
 namespace Antomic
 {
+    // Frames are drawn one at a time, they share the recording memory
+    static CommandBuffer sFrameCommands;
+
     void RendererFrame::QueueDrawable(const Ref<Drawable> &drawable)
     {
         ANTOMIC_PROFILE_FUNCTION("Renderer");
 
+        mVisibleCount++;
         switch (drawable->GetType())
         {
         case DrawableType::SPRITE:
-            mSpriteQueue.push(drawable);
+            mStats.Sprites++;
+            mSprites.push_back(*std::static_pointer_cast<Sprite>(drawable));
+            mSorted = false;
             return;
         case DrawableType::MESH:
-            mMeshQueue.push(drawable);
+            mStats.Meshes++;
+            QueueMesh(std::static_pointer_cast<Mesh>(drawable));
+            mSorted = false;
             return;
         default:
             ANTOMIC_ASSERT(false,"RendererFrame::QueueDrawable: Type not handled");
@@ -40,31 +52,141 @@ namespace Antomic
         }
     }
 
+    void RendererFrame::QueueMesh(const Ref<Mesh> &mesh)
+    {
+        auto &indices = mMeshBatchIndex[{mesh->GetVertexArray().get(), mesh->GetMaterial().get()}];
+
+        // Meshes only share a batch if they also bind the same resources
+        for (auto index : indices)
+        {
+            auto &batch = mMeshBatches[index];
+            if (batch.Meshes.front()->GetBindables() == mesh->GetBindables())
+            {
+                batch.Meshes.push_back(mesh);
+                batch.Models.push_back(mesh->GetModelMatrix());
+                return;
+            }
+        }
+
+        indices.push_back((uint32_t)mMeshBatches.size());
+        mMeshBatches.push_back({{mesh}, {mesh->GetModelMatrix()}, mesh->GetZOrder()});
+    }
+
+    void RendererFrame::SetProjection(const glm::mat4 &projection, const glm::mat4 &ortho)
+    {
+        mProjectionMatrix = projection;
+        mOrthoMatrix = ortho;
+    }
+
+    uint32_t RendererFrame::GetStateId(const void *state)
+    {
+        // Ids are dense and only valid for this frame
+        auto it = mStateIds.find(state);
+        if (it != mStateIds.end())
+        {
+            return it->second;
+        }
+
+        auto id = (uint32_t)mStateIds.size();
+        mStateIds[state] = id;
+        return id;
+    }
+
+    float RendererFrame::GetDepth(const glm::mat4 &model) const
+    {
+        // Distance along the view direction of the model origin
+        return -(mViewMatrix * model[3]).z;
+    }
+
+    const RenderQueue &RendererFrame::Sort()
+    {
+        ANTOMIC_PROFILE_FUNCTION("Renderer");
+
+        mQueue.Clear();
+
+        for (uint32_t index = 0; index < mMeshBatches.size(); index++)
+        {
+            auto &batch = mMeshBatches[index];
+            auto &mesh = batch.Meshes.front();
+            auto &material = mesh->GetMaterial();
+            auto key = RenderKey::Encode(RenderLayer::WORLD, batch.ZOrder, mesh->IsTranslucent(),
+                                         GetStateId(material->GetShader().get()), GetStateId(material.get()),
+                                         GetDepth(batch.Models.front()));
+            mQueue.Push(key, index);
+        }
+
+        // There is no depth test for sprites, overlapping ones must be drawn
+        // in submission order, opaque or not. The batches take care of the
+        // texture changes.
+        for (uint32_t index = 0; index < mSprites.size(); index++)
+        {
+            mQueue.Push(RenderKey::EncodeScreen(mSprites[index].GetZOrder(), index), index);
+        }
+
+        mQueue.Sort();
+        mSorted = true;
+        return mQueue;
+    }
+
     void RendererFrame::Draw()
     {
 
         ANTOMIC_PROFILE_FUNCTION("Renderer");
 
-        // Start the rendering process
-        RenderCommand::SetViewport(mViewport.Left, mViewport.Top, mViewport.Right, mViewport.Bottom);
-        RenderCommand::SetClearColor(mViewport.Color);
-        RenderCommand::Clear();
+        // Record the whole frame and execute it in one go
+        auto &commands = sFrameCommands;
+        commands.Reset();
+        commands.SetViewport(mViewport.Left, mViewport.Top, mViewport.Right, mViewport.Bottom);
+        commands.SetClearColor(mViewport.Color);
+        commands.Clear();
 
-        // First we draw the 3D elements
-        while (!mMeshQueue.empty())
+        // 3D elements sort before the 2D ones, sprites are batched
+        bool batching = false;
+        if (!mSorted)
         {
-            auto drawable = mMeshQueue.front();
-            mMeshQueue.pop();
-            drawable->Draw();
+            Sort();
         }
 
-        // Now we draw the 2D elements
-        while (!mSpriteQueue.empty())
+        for (auto &item : mQueue.GetItems())
         {
-            auto drawable = mSpriteQueue.front();
-            mSpriteQueue.pop();
-            drawable->Draw();
+            if (RenderKey::GetLayer(item.Key) == RenderLayer::WORLD)
+            {
+                auto &batch = mMeshBatches[item.Index];
+                Mesh::RecordInstanced(commands, batch.Meshes.front(), batch.Models);
+                continue;
+            }
+
+            if (!batching)
+            {
+                Render2d::BeginBatch(commands);
+                batching = true;
+            }
+            mSprites[item.Index].Draw();
+        }
+
+        if (batching)
+        {
+            Render2d::EndBatch();
+            mStats.UploadBytes += Render2d::GetStreamedBytes();
+        }
+
+        mStats.MeshBatches = (uint32_t)mMeshBatches.size();
+        mStats.Record(commands);
+        mStats.Emit();
+
+        RenderCommand::Execute(commands);
+
+        if (batching)
+        {
+            Render2d::EndFrame();
         }
+
+        mSprites.clear();
+        mMeshBatches.clear();
+        mMeshBatchIndex.clear();
+        mStateIds.clear();
+        mQueue.Clear();
+        mSorted = false;
     }
 
 } // namespace Antomic
@@ -16,14 +16,30 @@
 #pragma once
 #include "Core/Base.h"
 #include "Renderer/Renderer.h"
+#include "Renderer/RenderQueue.h"
+#include "Renderer/RendererStats.h"
+#include "Renderer/Frustum.h"
+#include "Renderer/Bounds.h"
+#include "Renderer/Sprite.h"
 #include "glm/glm.hpp"
 
 namespace Antomic
 {
+    // Meshes sharing geometry, material and bindables, drawn instanced.
+    // Model matrices are copied when queued, the frame may be drawn on
+    // the render thread while the scene is already updating the next one
+    struct MeshBatch
+    {
+        VectorRef<Mesh> Meshes;
+        std::vector<glm::mat4> Models;
+        int ZOrder;
+    };
+
     class RendererFrame
     {
     public:
-        RendererFrame(const RendererViewport &viewport, const glm::mat4 &view) : mViewport(viewport), mViewMatrix(view) {}
+        RendererFrame(const RendererViewport &viewport, const glm::mat4 &view)
+            : mViewport(viewport), mViewMatrix(view), mProjectionMatrix(1.0f), mOrthoMatrix(1.0f) {}
         virtual ~RendererFrame() = default;
 
         void QueueDrawable(const Ref<Drawable> &drawable);
@@ -31,12 +47,68 @@ namespace Antomic
 
         const RendererViewport &GetViewport() const { return mViewport; }
         const glm::mat4 &GetViewMatrix() const { return mViewMatrix; }
+        const std::vector<MeshBatch> &GetMeshBatches() const { return mMeshBatches; }
+        const std::vector<Sprite> &GetSprites() const { return mSprites; }
+
+        // Camera projections, uploaded to the camera buffer before drawing
+        const glm::mat4 &GetProjectionMatrix() const { return mProjectionMatrix; }
+        const glm::mat4 &GetOrthoMatrix() const { return mOrthoMatrix; }
+        void SetProjection(const glm::mat4 &projection, const glm::mat4 &ortho);
+
+        // View volume used to cull the drawables submitted to the frame
+        inline const Frustum &GetFrustum() const { return mFrustum; }
+        inline void SetFrustum(const Frustum &frustum) { mFrustum = frustum; }
+
+        // Orthographic view rectangle used to cull the 2D nodes
+        inline Rect GetViewRect() const
+        {
+            return Rect(glm::vec2(mViewport.Left, mViewport.Top), glm::vec2(mViewport.Right, mViewport.Bottom));
+        }
+
+        // Culling statistics, drawables queued and skipped this frame
+        inline uint32_t GetVisibleCount() const { return mVisibleCount; }
+        inline uint32_t GetCulledCount() const { return mCulledCount; }
+        inline void AddCulled(uint32_t count) { mCulledCount += count; }
+
+        // Counters of the frame, complete once it was drawn
+        inline const RendererStats &GetStats() const { return mStats; }
+        inline RendererStats &GetStats() { return mStats; }
+
+        // Builds the sort keys and sorts the render queue, Draw only sorts
+        // when the frame was not sorted after being built
+        const RenderQueue &Sort();
+
+    private:
+        using MeshBatchKey = std::pair<VertexArray *, Material *>;
+
+        struct MeshBatchKeyHash
+        {
+            size_t operator()(const MeshBatchKey &key) const
+            {
+                return std::hash<void *>()(key.first) ^ (std::hash<void *>()(key.second) << 1);
+            }
+        };
+
+    private:
+        void QueueMesh(const Ref<Mesh> &mesh);
+        uint32_t GetStateId(const void *state);
+        float GetDepth(const glm::mat4 &model) const;
 
     private:
-        QueueRef<Drawable> mSpriteQueue;
-        QueueRef<Drawable> mMeshQueue;
+        std::vector<Sprite> mSprites;
+        std::vector<MeshBatch> mMeshBatches;
+        std::unordered_map<MeshBatchKey, std::vector<uint32_t>, MeshBatchKeyHash> mMeshBatchIndex;
+        std::unordered_map<const void *, uint32_t> mStateIds;
+        RenderQueue mQueue;
+        bool mSorted = false;
         RendererViewport mViewport;
         glm::mat4 mViewMatrix;
+        glm::mat4 mProjectionMatrix;
+        glm::mat4 mOrthoMatrix;
+        Frustum mFrustum;
+        uint32_t mVisibleCount = 0;
+        uint32_t mCulledCount = 0;
+        RendererStats mStats;
     };
 
-} // namespace Antomic
\ No newline at end of file
+} // namespace Antomic
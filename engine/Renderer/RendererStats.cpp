@@ -0,0 +1,99 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "Renderer/RendererStats.h"
+#include "Renderer/CommandBuffer.h"
+#include "Profiling/Instrumentor.h"
+
+namespace Antomic
+{
+    void RendererStats::Record(const CommandBuffer &commands)
+    {
+        const Shader *shader = nullptr;
+        const VertexArray *vertices = nullptr;
+        std::unordered_map<uint32_t, const Texture *> textures;
+
+        for (auto header = commands.Begin(); header != commands.End(); header = CommandBuffer::Next(header))
+        {
+            switch (header->Type)
+            {
+            case RenderCommandType::BIND_SHADER:
+            {
+                auto &command = CommandBuffer::GetCommand<RenderCommands::BindShader>(header);
+                ShaderBinds += command.Program != shader ? 1 : 0;
+                shader = command.Program;
+                break;
+            }
+            case RenderCommandType::BIND_TEXTURE:
+            {
+                auto &command = CommandBuffer::GetCommand<RenderCommands::BindTexture>(header);
+                auto &bound = textures[command.Slot];
+                TextureBinds += command.Image != bound ? 1 : 0;
+                bound = command.Image;
+                break;
+            }
+            case RenderCommandType::SET_UNIFORM:
+            {
+                auto &command = CommandBuffer::GetCommand<RenderCommands::SetUniform>(header);
+                UniformUploads++;
+                UploadBytes += command.DataSize;
+                break;
+            }
+            case RenderCommandType::UPDATE_BUFFER:
+                UploadBytes += CommandBuffer::GetCommand<RenderCommands::UpdateBuffer>(header).DataSize;
+                break;
+            case RenderCommandType::DRAW_INDEXED:
+            {
+                auto &command = CommandBuffer::GetCommand<RenderCommands::DrawIndexed>(header);
+                VertexArrayBinds += command.Vertices != vertices ? 1 : 0;
+                vertices = command.Vertices;
+                DrawCalls++;
+                Instances++;
+                Indices += command.IndexCount;
+                Triangles += command.IndexCount / 3;
+                break;
+            }
+            case RenderCommandType::DRAW_INDEXED_INSTANCED:
+            {
+                auto &command = CommandBuffer::GetCommand<RenderCommands::DrawIndexedInstanced>(header);
+                VertexArrayBinds += command.Vertices != vertices ? 1 : 0;
+                vertices = command.Vertices;
+                DrawCalls++;
+                Instances += command.InstanceCount;
+                Indices += (uint64_t)command.IndexCount * command.InstanceCount;
+                Triangles += (uint64_t)command.IndexCount / 3 * command.InstanceCount;
+                break;
+            }
+            default:
+                break;
+            }
+        }
+    }
+
+    void RendererStats::Emit() const
+    {
+#if ANTOMIC_PROFILE
+        Instrumentor::Get().WriteCounter("Draws", "Renderer",
+                                         {{"draws", DrawCalls}, {"instances", Instances}, {"triangles", Triangles}});
+        Instrumentor::Get().WriteCounter("State changes", "Renderer",
+                                         {{"shaders", ShaderBinds}, {"textures", TextureBinds}, {"vertex arrays", VertexArrayBinds}});
+        Instrumentor::Get().WriteCounter("Uploads", "Renderer",
+                                         {{"uniforms", UniformUploads}, {"bytes", UploadBytes}});
+        Instrumentor::Get().WriteCounter("Drawables", "Renderer",
+                                         {{"sprites", Sprites}, {"meshes", Meshes}, {"mesh batches", MeshBatches}});
+#endif
+    }
+
+} // namespace Antomic
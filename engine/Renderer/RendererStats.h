@@ -0,0 +1,57 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+#include "Core/Base.h"
+
+namespace Antomic
+{
+    /*************************************************************
+     * RendererStats Implementation
+     *************************************************************/
+
+    // Per frame counters. They are taken from the recorded commands, not
+    // from the backend, so every render API reports the same numbers.
+    struct RendererStats
+    {
+        uint32_t DrawCalls = 0;
+        uint32_t Instances = 0;
+        uint64_t Indices = 0;
+        uint64_t Triangles = 0;
+
+        // A bind of the object that is still bound, the last shader or
+        // vertex array used or the last texture on the same slot, is left
+        // out as the backend skips it too. Objects bound again after
+        // another one are counted.
+        uint32_t ShaderBinds = 0;
+        uint32_t TextureBinds = 0;
+        uint32_t VertexArrayBinds = 0;
+
+        uint32_t UniformUploads = 0;
+        uint64_t UploadBytes = 0;
+
+        // Drawables queued per type, and the batches meshes ended up in
+        uint32_t Sprites = 0;
+        uint32_t Meshes = 0;
+        uint32_t MeshBatches = 0;
+
+        // Adds the cost of executing the commands
+        void Record(const CommandBuffer &commands);
+
+        // Counter events on the profiling trace
+        void Emit() const;
+    };
+
+} // namespace Antomic
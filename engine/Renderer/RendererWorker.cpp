@@ -14,20 +14,136 @@
    limitations under the License.
 */
 #include "Renderer/RendererWorker.h"
-#include "Graph/Scene.h"
 #include "Renderer/Renderer.h"
 #include "Renderer/RendererFrame.h"
+#include "Renderer/RenderCommand.h"
 #include "Platform/Platform.h"
 #include "Core/Log.h"
 
 namespace Antomic
 {
+    RendererWorker::RendererWorker(const Ref<Renderer> &renderer, uint32_t maxFrames)
+        : mRenderer(renderer), mMaxFrames(maxFrames), mRunning(false),
+          mFramesInFlight(0), mTasksQueued(0), mTasksDone(0)
+    {
+        ANTOMIC_ASSERT(mMaxFrames > 0, "RendererWorker: At least one frame in flight is needed");
+    }
+
+    RendererWorker::~RendererWorker()
+    {
+        Stop();
+    }
+
+    void RendererWorker::Start()
+    {
+        if (mRunning)
+        {
+            return;
+        }
+
+        // A context can only be current on one thread at a time
+        Platform::MakeContextCurrent(false);
+        mRunning = true;
+        mThread = std::thread(&RendererWorker::Run, this);
+    }
+
+    void RendererWorker::Stop()
+    {
+        if (!mRunning)
+        {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mRunning = false;
+        }
+        mWorkReady.notify_all();
+        mThread.join();
+
+        Platform::MakeContextCurrent(true);
+    }
+
+    void RendererWorker::Submit(const Ref<RendererFrame> &frame)
+    {
+        if (!mRunning)
+        {
+            mRenderer->SubmitFrame(frame);
+            return;
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mWorkDone.wait(lock, [this] { return mFramesInFlight < mMaxFrames; });
+            mFrames.push(frame);
+            mFramesInFlight++;
+        }
+        mWorkReady.notify_all();
+    }
+
+    void RendererWorker::Execute(const std::function<void()> &task)
+    {
+        if (!mRunning || std::this_thread::get_id() == mThread.get_id())
+        {
+            task();
+            return;
+        }
+
+        std::unique_lock<std::mutex> lock(mMutex);
+        mTasks.push(task);
+        auto ticket = ++mTasksQueued;
+        mWorkReady.notify_all();
+        mWorkDone.wait(lock, [this, ticket] { return mTasksDone >= ticket; });
+    }
 
     void RendererWorker::Run()
     {
-        ANTOMIC_INFO("RendererWorker: Scene update worker started");
+        ANTOMIC_INFO("RendererWorker: Render worker started");
+
+        Platform::MakeContextCurrent(true);
+
+        std::unique_lock<std::mutex> lock(mMutex);
+        while (true)
+        {
+            mWorkReady.wait(lock, [this] { return !mTasks.empty() || !mFrames.empty() || !mRunning; });
+
+            // Tasks go first, the caller is blocked waiting on them
+            if (!mTasks.empty())
+            {
+                auto task = std::move(mTasks.front());
+                mTasks.pop();
+
+                lock.unlock();
+                task();
+                lock.lock();
+
+                mTasksDone++;
+                mWorkDone.notify_all();
+                continue;
+            }
+
+            // Pending frames are still drawn when stopping
+            if (!mFrames.empty())
+            {
+                auto frame = mFrames.front();
+                mFrames.pop();
+
+                lock.unlock();
+                mRenderer->SubmitFrame(frame);
+                frame = nullptr;
+                lock.lock();
+
+                mFramesInFlight--;
+                mWorkDone.notify_all();
+                continue;
+            }
+
+            break;
+        }
+        lock.unlock();
 
-        // TODO: Optmize render queue
+        RenderCommand::CollectReleased();
+        Platform::MakeContextCurrent(false);
 
         ANTOMIC_INFO("RendererWorker: Render worker stopped");
     }
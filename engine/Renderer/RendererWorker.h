@@ -18,14 +18,45 @@
 
 namespace Antomic
 {
+    // Render thread owning the render context. Frames built on the main
+    // thread are handed over through a bounded queue, so the next frame
+    // is built while the previous one is being submitted
     class RendererWorker
     {
     public:
-        RendererWorker() = default;
-        ~RendererWorker() = default;
+        RendererWorker(const Ref<Renderer> &renderer, uint32_t maxFrames = 2);
+        ~RendererWorker();
 
     public:
+        // Moves the render context from the caller to the render thread
+        // and back when stopped, pending frames are drawn before stopping
+        void Start();
+        void Stop();
+        inline bool IsRunning() const { return mRunning; }
+
+        // Blocks while maxFrames frames are queued or being drawn
+        void Submit(const Ref<RendererFrame> &frame);
+
+        // Runs the task on the render thread between frames and waits
+        // for it, resources using the render context go through here
+        void Execute(const std::function<void()> &task);
+
+    private:
         void Run();
+
+    private:
+        Ref<Renderer> mRenderer;
+        uint32_t mMaxFrames;
+        bool mRunning;
+        std::thread mThread;
+        std::mutex mMutex;
+        std::condition_variable mWorkReady;
+        std::condition_variable mWorkDone;
+        QueueRef<RendererFrame> mFrames;
+        std::queue<std::function<void()>> mTasks;
+        uint32_t mFramesInFlight;
+        uint64_t mTasksQueued;
+        uint64_t mTasksDone;
     };
 
 } // namespace Antomic
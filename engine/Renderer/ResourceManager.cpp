@@ -0,0 +1,71 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "enginepch.h"
+#include "Renderer/ResourceManager.h"
+#include "Renderer/Shader.h"
+#include "Renderer/TextureAtlas.h"
+#include "Profiling/Instrumentor.h"
+
+namespace Antomic
+{
+    std::recursive_mutex ResourceManager::sMutex;
+    std::unordered_map<std::string, std::weak_ptr<void>> ResourceManager::sResources;
+
+    void ResourceManager::LoadTexture(const std::string &path, const TextureLoadedCallback &callback)
+    {
+        TextureLoader::Get().Load(path, callback);
+    }
+
+    Ref<Shader> ResourceManager::LoadShader(const std::string &vertexPath, const std::string &pixelPath)
+    {
+        auto key = "shader:" + vertexPath + "|" + pixelPath;
+        return Load<Shader>(key, [&]() { return Shader::CreateFromFile(vertexPath, pixelPath); });
+    }
+
+    uint32_t ResourceManager::GetUseCount(const std::string &key)
+    {
+        std::lock_guard<std::recursive_mutex> lock(sMutex);
+        auto it = sResources.find(key);
+        return it != sResources.end() ? (uint32_t)it->second.use_count() : 0;
+    }
+
+    uint32_t ResourceManager::GetResourceCount()
+    {
+        std::lock_guard<std::recursive_mutex> lock(sMutex);
+        uint32_t count = 0;
+        for (auto &[key, resource] : sResources)
+        {
+            count += resource.expired() ? 0 : 1;
+        }
+        return count;
+    }
+
+    void ResourceManager::Collect()
+    {
+        ANTOMIC_PROFILE_FUNCTION("Renderer");
+
+        {
+            std::lock_guard<std::recursive_mutex> lock(sMutex);
+            for (auto it = sResources.begin(); it != sResources.end();)
+            {
+                it = it->second.expired() ? sResources.erase(it) : std::next(it);
+            }
+        }
+
+        TextureAtlas::Get().Evict();
+    }
+
+} // namespace Antomic
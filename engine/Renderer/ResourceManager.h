@@ -0,0 +1,90 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+#include "Core/Base.h"
+#include "Renderer/TextureLoader.h"
+
+namespace Antomic
+{
+    /*************************************************************
+     * ResourceManager Implementation
+     *************************************************************/
+
+    // Shared render resources keyed by path and parameters. Every resource
+    // is created once and handed out while anything still holds it, the
+    // last handle going away releases it along with its GPU memory.
+    class ResourceManager
+    {
+    public:
+        // Decoded and uploaded once by the TextureLoader, the callback runs
+        // on the main thread
+        static void LoadTexture(const std::string &path, const TextureLoadedCallback &callback);
+
+        static Ref<Shader> LoadShader(const std::string &vertexPath, const std::string &pixelPath);
+
+        // Name tells apart materials of the same type built with different
+        // arguments, the arguments are only used on the first load
+        template <typename T, typename... Args>
+        static Ref<T> LoadMaterial(const std::string &name, Args &&...args)
+        {
+            auto key = std::string("material:") + typeid(T).name() + "|" + name;
+            return Load<T>(key, [&]() { return CreateRef<T>(std::forward<Args>(args)...); });
+        }
+
+        template <typename T>
+        static Ref<T> LoadMaterial()
+        {
+            return LoadMaterial<T>(std::string());
+        }
+
+        // Handles held outside the manager, 0 once released
+        static uint32_t GetUseCount(const std::string &key);
+        static uint32_t GetResourceCount();
+
+        // Render thread, forgets released resources and evicts atlas pages
+        // no texture uses anymore
+        static void Collect();
+
+    private:
+        template <typename T, typename F>
+        static Ref<T> Load(const std::string &key, const F &create)
+        {
+            // Recursive, materials load their shaders while being created
+            std::lock_guard<std::recursive_mutex> lock(sMutex);
+
+            auto it = sResources.find(key);
+            if (it != sResources.end())
+            {
+                if (auto resource = it->second.lock())
+                {
+                    return std::static_pointer_cast<T>(resource);
+                }
+            }
+
+            Ref<T> resource = create();
+            if (resource != nullptr)
+            {
+                sResources[key] = resource;
+            }
+            return resource;
+        }
+
+    private:
+        static std::recursive_mutex sMutex;
+        static std::unordered_map<std::string, std::weak_ptr<void>> sResources;
+    };
+
+} // namespace Antomic
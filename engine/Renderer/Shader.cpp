@@ -14,7 +14,9 @@
    limitations under the License.
 */
 #include "Core/Log.h"
+#include "Core/Archive.h"
 #include "Renderer/Shader.h"
+#include "Renderer/CommandBuffer.h"
 #include "Platform/RenderAPI.h"
 #include "Platform/NullRenderer/Shader.h"
 #include "Platform/Platform.h"
@@ -50,6 +52,19 @@ namespace Antomic
             return 16;
         case ShaderDataType::Bool:
             return 1;
+        case ShaderDataType::Half2:
+            return 4;
+        case ShaderDataType::Half4:
+            return 8;
+        case ShaderDataType::Byte4:
+        case ShaderDataType::UByte4:
+            return 4;
+        case ShaderDataType::Short2:
+            return 4;
+        case ShaderDataType::Short4:
+            return 8;
+        case ShaderDataType::Int1010102:
+            return 4;
         }
 
         ANTOMIC_ASSERT(false, "ShaderDataType: Unknown data type")
@@ -82,38 +97,63 @@ namespace Antomic
             return 16;
         case ShaderDataType::Bool:
             return 4;
+        case ShaderDataType::Half2:
+        case ShaderDataType::Half4:
+        case ShaderDataType::Byte4:
+        case ShaderDataType::UByte4:
+        case ShaderDataType::Short2:
+        case ShaderDataType::Short4:
+        case ShaderDataType::Int1010102:
+            // Vertex attributes only, std140 has no packed types
+            break;
         }
 
         ANTOMIC_ASSERT(false, "ShaderDataType: Unknown data type")
         return 0;
     }
 
+    int32_t Shader::GetUniformLocation(const std::string &name, ShaderDataType type) const
+    {
+        auto uniform = GetUniform(name);
+        if (uniform == nullptr)
+        {
+            return -1;
+        }
+
+        if (uniform->Type != type)
+        {
+            ANTOMIC_ERROR("Shader: Uniform {0} does not match the handle type", name);
+            ANTOMIC_ASSERT(false, "Shader: Uniform type mismatch!");
+            return -1;
+        }
+
+        return uniform->Location;
+    }
+
+    void Shader::Record(CommandBuffer &commands) const
+    {
+        commands.BindShader(this);
+    }
+
     Ref<Shader> Shader::CreateFromFile(const std::string &vertexSrcPath, const std::string &pixelSrcPath)
     {
         std::string vertexSrc, pixelSrc;
 
-        if (!std::filesystem::exists(vertexSrcPath))
+        // Mounted archives first, then loose files
+        if (!Archive::ReadFile(vertexSrcPath, vertexSrc))
         {
             ANTOMIC_ERROR("Shader: Could not find vertex shader file {0}", vertexSrcPath);
             ANTOMIC_ASSERT(false, "Vertex shader file not found!");
             return nullptr;
         }
 
-        if (!std::filesystem::exists(pixelSrcPath))
+        if (!Archive::ReadFile(pixelSrcPath, pixelSrc))
         {
             ANTOMIC_ERROR("Shader: Could not find pixel shader file {0}", pixelSrcPath);
             ANTOMIC_ASSERT(false, "Pixel shader file not found!");
             return nullptr;
         }
 
-        std::ifstream vertexSrcFile(vertexSrcPath);
-        vertexSrc = std::string((std::istreambuf_iterator<char>(vertexSrcFile)),
-                                std::istreambuf_iterator<char>());
-
-        std::ifstream pixelSrcFile(pixelSrcPath);
-        pixelSrc = std::string((std::istreambuf_iterator<char>(pixelSrcFile)),
-                               std::istreambuf_iterator<char>());
-
         return CreateFromSource(vertexSrc, pixelSrc);
     }
 
@@ -32,20 +32,95 @@ namespace Antomic
         Int2,
         Int3,
         Int4,
-        Bool
+        Bool,
+
+        // Packed vertex attributes, read as floats by the shader
+        Half2,
+        Half4,
+        Byte4,
+        UByte4,
+        Short2,
+        Short4,
+        Int1010102
     };
 
     uint32_t ShaderDataTypeSize(ShaderDataType t);
     uint32_t ShaderDataTypeAlignment(ShaderDataType t);
 
+    template <typename T>
+    struct ShaderDataTypeOf;
+
+    template <>
+    struct ShaderDataTypeOf<float> { static constexpr ShaderDataType Value = ShaderDataType::Float; };
+    template <>
+    struct ShaderDataTypeOf<glm::vec2> { static constexpr ShaderDataType Value = ShaderDataType::Vec2; };
+    template <>
+    struct ShaderDataTypeOf<glm::vec3> { static constexpr ShaderDataType Value = ShaderDataType::Vec3; };
+    template <>
+    struct ShaderDataTypeOf<glm::vec4> { static constexpr ShaderDataType Value = ShaderDataType::Vec4; };
+    template <>
+    struct ShaderDataTypeOf<glm::mat3> { static constexpr ShaderDataType Value = ShaderDataType::Mat3; };
+    template <>
+    struct ShaderDataTypeOf<glm::mat4> { static constexpr ShaderDataType Value = ShaderDataType::Mat4; };
+
+    /*************************************************************
+     * ShaderUniform Implementation
+     *************************************************************/
+
+    // Active uniform of a linked shader
+    struct ShaderUniform
+    {
+        int32_t Location;
+        ShaderDataType Type;
+        uint32_t Count;
+    };
+
+    // Uniform location resolved once, typed by the value it accepts
+    template <typename T>
+    class UniformHandle
+    {
+    public:
+        UniformHandle() = default;
+        explicit UniformHandle(int32_t location) : mLocation(location) {}
+
+    public:
+        inline int32_t GetLocation() const { return mLocation; }
+        inline bool IsValid() const { return mLocation != -1; }
+
+    private:
+        int32_t mLocation = -1;
+    };
+
+    /*************************************************************
+     * Shader Implementation
+     *************************************************************/
+
     class Shader : public Bindable
     {
     public:
         virtual ~Shader() = default;
 
     public:
+        virtual void Record(CommandBuffer &commands) const override;
 
-        // Uniform Commands
+        // Uniform reflection, returns nullptr if the uniform is not active
+        virtual const ShaderUniform *GetUniform(const std::string &name) const = 0;
+
+        template <typename T>
+        UniformHandle<T> GetUniformHandle(const std::string &name) const
+        {
+            return UniformHandle<T>(GetUniformLocation(name, ShaderDataTypeOf<T>::Value));
+        }
+
+        // Typed Uniform Commands
+        virtual void SetUniformValue(UniformHandle<float> handle, float value) = 0;
+        virtual void SetUniformValue(UniformHandle<glm::vec2> handle, const glm::vec2 &value) = 0;
+        virtual void SetUniformValue(UniformHandle<glm::vec3> handle, const glm::vec3 &value) = 0;
+        virtual void SetUniformValue(UniformHandle<glm::vec4> handle, const glm::vec4 &value) = 0;
+        virtual void SetUniformValue(UniformHandle<glm::mat3> handle, const glm::mat3 &value) = 0;
+        virtual void SetUniformValue(UniformHandle<glm::mat4> handle, const glm::mat4 &value) = 0;
+
+        // Uniform Commands, resolving the name on every call
         virtual void SetUniformValue(const std::string& name, float value) = 0;
         virtual void SetUniformValue(const std::string& name, const glm::vec2 &value) = 0;
         virtual void SetUniformValue(const std::string& name, const glm::vec3 &value) = 0;
@@ -56,6 +131,9 @@ namespace Antomic
     public:
         static Ref<Shader> CreateFromFile(const std::string &vertexSrcPath, const std::string &pixelSrcPath);
         static Ref<Shader> CreateFromSource(const std::string &vertexSrc, const std::string &pixelSrc);
+
+    private:
+        int32_t GetUniformLocation(const std::string &name, ShaderDataType type) const;
     };
 
 } // namespace Antomic
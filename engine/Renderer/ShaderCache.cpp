@@ -0,0 +1,153 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "enginepch.h"
+#include "Renderer/ShaderCache.h"
+#include "Core/Log.h"
+
+namespace Antomic
+{
+    // The version is bumped when the layout of the cache files changes
+    static const uint32_t sCacheMagic = 0x43535341; // "ASSC"
+    static const uint32_t sCacheVersion = 1;
+
+    struct ShaderCacheHeader
+    {
+        uint32_t Magic;
+        uint32_t Version;
+        uint64_t Key;
+        uint32_t Format;
+        uint32_t Size;
+    };
+
+    std::string ShaderCache::sDirectory = "cache/shaders";
+
+    uint64_t ShaderCache::Hash(std::initializer_list<std::string_view> parts)
+    {
+        uint64_t hash = 14695981039346656037ull;
+        auto append = [&hash](const void *data, size_t size) {
+            auto bytes = static_cast<const uint8_t *>(data);
+            for (size_t i = 0; i < size; i++)
+            {
+                hash ^= bytes[i];
+                hash *= 1099511628211ull;
+            }
+        };
+
+        for (auto &part : parts)
+        {
+            uint64_t size = part.size();
+            append(&size, sizeof(size));
+            append(part.data(), part.size());
+        }
+        return hash;
+    }
+
+    std::filesystem::path ShaderCache::GetPath(uint64_t key)
+    {
+        std::stringstream name;
+        name << std::hex << std::setw(16) << std::setfill('0') << key << ".bin";
+        return std::filesystem::path(sDirectory) / name.str();
+    }
+
+    bool ShaderCache::Load(uint64_t key, uint32_t &format, std::vector<uint8_t> &binary)
+    {
+        if (!IsEnabled())
+        {
+            return false;
+        }
+
+        auto path = GetPath(key);
+        std::error_code error;
+        auto fileSize = std::filesystem::file_size(path, error);
+        std::ifstream file(path, std::ios::binary);
+        if (error || !file)
+        {
+            return false;
+        }
+
+        ShaderCacheHeader header;
+        if (!file.read(reinterpret_cast<char *>(&header), sizeof(header)) ||
+            header.Magic != sCacheMagic || header.Version != sCacheVersion || header.Key != key)
+        {
+            return false;
+        }
+
+        // Entries are written whole, a size not matching the file is a
+        // corrupt entry and is never allocated
+        if (header.Size != fileSize - sizeof(header))
+        {
+            ANTOMIC_WARN("ShaderCache: Corrupt entry {0}", path.string());
+            file.close();
+            Remove(key);
+            return false;
+        }
+
+        binary.resize(header.Size);
+        if (!file.read(reinterpret_cast<char *>(binary.data()), header.Size))
+        {
+            binary.clear();
+            file.close();
+            Remove(key);
+            return false;
+        }
+
+        format = header.Format;
+        return true;
+    }
+
+    bool ShaderCache::Store(uint64_t key, uint32_t format, const std::vector<uint8_t> &binary)
+    {
+        if (!IsEnabled())
+        {
+            return false;
+        }
+
+        std::error_code error;
+        std::filesystem::create_directories(sDirectory, error);
+
+        // Written aside and renamed, a crash never leaves a truncated binary
+        auto path = GetPath(key);
+        auto temporary = path;
+        temporary += ".tmp";
+        {
+            std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+            ShaderCacheHeader header = {sCacheMagic, sCacheVersion, key, format, (uint32_t)binary.size()};
+            if (!file.write(reinterpret_cast<const char *>(&header), sizeof(header)) ||
+                !file.write(reinterpret_cast<const char *>(binary.data()), binary.size()))
+            {
+                ANTOMIC_WARN("ShaderCache: Could not write {0}", temporary.string());
+                file.close();
+                std::filesystem::remove(temporary, error);
+                return false;
+            }
+        }
+
+        std::filesystem::rename(temporary, path, error);
+        if (error)
+        {
+            std::filesystem::remove(temporary, error);
+            return false;
+        }
+        return true;
+    }
+
+    void ShaderCache::Remove(uint64_t key)
+    {
+        std::error_code error;
+        std::filesystem::remove(GetPath(key), error);
+    }
+
+} // namespace Antomic
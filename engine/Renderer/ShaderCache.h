@@ -0,0 +1,51 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+#include "Core/Base.h"
+
+namespace Antomic
+{
+    /*************************************************************
+     * ShaderCache Implementation
+     *************************************************************/
+
+    // Linked program binaries kept on disk between launches. Binaries are
+    // keyed by a hash of everything that produced them, the sources and the
+    // driver, so a new driver or an edited shader never loads a stale blob.
+    class ShaderCache
+    {
+    public:
+        // Directory the binaries are kept in, an empty path disables the cache
+        static void SetDirectory(const std::string &path) { sDirectory = path; }
+        inline static const std::string &GetDirectory() { return sDirectory; }
+        inline static bool IsEnabled() { return !sDirectory.empty(); }
+
+        // 64 bit FNV-1a of the parts, each part is length prefixed
+        static uint64_t Hash(std::initializer_list<std::string_view> parts);
+
+        // Binary operations, format is the driver binary format
+        static bool Load(uint64_t key, uint32_t &format, std::vector<uint8_t> &binary);
+        static bool Store(uint64_t key, uint32_t format, const std::vector<uint8_t> &binary);
+        static void Remove(uint64_t key);
+
+    private:
+        static std::filesystem::path GetPath(uint64_t key);
+
+    private:
+        static std::string sDirectory;
+    };
+
+} // namespace Antomic
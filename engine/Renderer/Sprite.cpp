@@ -14,8 +14,15 @@
    limitations under the License.
 */
 #include "Renderer/Sprite.h"
+#include "Renderer/TextureAtlas.h"
 
 namespace Antomic
 {
+    void Sprite::SetTextureRegion(const Ref<TextureRegion> &region)
+    {
+        mRegion = region;
+        mTexture = region != nullptr ? region->GetTexture() : nullptr;
+        mTextureRect = region != nullptr ? region->GetRect() : glm::vec4(0.f, 0.f, 1.f, 1.f);
+    }
 
 } // namespace Antomic
@@ -33,8 +33,23 @@ namespace Antomic
 
         inline const glm::vec4 &GetSpriteColor() const { return mSpriteColor; }
         inline void SetSpriteColor(const glm::vec4 &color) { mSpriteColor = color; }
+        virtual bool IsTranslucent() const override { return mSpriteColor.a < 1.0f; }
+
+        inline const Ref<Texture> &GetTexture() const { return mTexture; }
+        inline void SetTexture(const Ref<Texture> &texture) { mTexture = texture; }
+
+        // Texture coordinates of the sprite as (u0, v0, u1, v1)
+        inline const glm::vec4 &GetTextureRect() const { return mTextureRect; }
+        inline void SetTextureRect(const glm::vec4 &rect) { mTextureRect = rect; }
+
+        // Samples the region, the region keeps its atlas page alive
+        inline const Ref<TextureRegion> &GetTextureRegion() const { return mRegion; }
+        void SetTextureRegion(const Ref<TextureRegion> &region);
 
     private:
         glm::vec4 mSpriteColor = glm::vec4(1.f, 1.f, 1.f, 1.f);
+        glm::vec4 mTextureRect = glm::vec4(0.f, 0.f, 1.f, 1.f);
+        Ref<Texture> mTexture;
+        Ref<TextureRegion> mRegion;
     };
 }
\ No newline at end of file
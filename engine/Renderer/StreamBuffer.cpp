@@ -0,0 +1,85 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "Renderer/StreamBuffer.h"
+#include "Core/Log.h"
+#include "Platform/Platform.h"
+#include "Platform/RenderAPI.h"
+#include "Platform/NullRenderer/StreamBuffer.h"
+#ifdef ANTOMIC_GL_RENDERER
+#include "Platform/OpenGL/StreamBuffer.h"
+#endif
+
+namespace Antomic
+{
+    StreamBuffer::StreamBuffer(uint32_t regionSize, uint32_t regions)
+        : mRegionSize(regionSize), mRegions(regions)
+    {
+        ANTOMIC_ASSERT(regions > 0, "StreamBuffer: At least one region is needed!");
+    }
+
+    StreamAllocation StreamBuffer::Allocate(uint32_t size, uint32_t alignment)
+    {
+        if (size > mRegionSize)
+        {
+            return {nullptr, 0, 0};
+        }
+
+        // Alignment does not need to be a power of two, vertex data is
+        // aligned to the vertex stride. The region is never left here, the
+        // draws reading it may not be submitted yet.
+        auto base = mCurrentRegion * mRegionSize;
+        auto offset = ((base + mRegionOffset + alignment - 1) / alignment) * alignment - base;
+        if (offset + size > mRegionSize)
+        {
+            return {nullptr, 0, 0};
+        }
+
+        mRegionOffset = offset + size;
+        return {GetMappedData() + base + offset, base + offset, size};
+    }
+
+    void StreamBuffer::Advance()
+    {
+        PlaceFence(mCurrentRegion);
+        mCurrentRegion = (mCurrentRegion + 1) % mRegions;
+        mRegionOffset = 0;
+        WaitFence(mCurrentRegion);
+    }
+
+    void StreamBuffer::Upload(uint32_t *data, uint32_t size) const
+    {
+        ANTOMIC_ASSERT(false, "StreamBuffer: Use Allocate to write data!");
+    }
+
+    void StreamBuffer::SetData(const void *data, uint32_t size)
+    {
+        ANTOMIC_ASSERT(false, "StreamBuffer: Use Allocate to write data!");
+    }
+
+    Ref<StreamBuffer> StreamBuffer::Create(uint32_t regionSize, uint32_t regions)
+    {
+        switch (Platform::GetRenderAPIDialect())
+        {
+#ifdef ANTOMIC_GL_RENDERER
+        case RenderAPIDialect::OPENGL:
+            return CreateRef<OpenGLStreamBuffer>(regionSize, regions);
+#endif
+        default:
+            return CreateRef<NullStreamBuffer>(regionSize, regions);
+        }
+    }
+
+} // namespace Antomic
@@ -0,0 +1,75 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+#include "Core/Base.h"
+#include "Renderer/Buffers.h"
+
+namespace Antomic
+{
+    struct StreamAllocation
+    {
+        uint8_t *Data;
+        uint32_t Offset;
+        uint32_t Size;
+    };
+
+    // Ring buffer for data written once per draw. The storage is split in
+    // regions guarded by fences, allocations are taken from the current
+    // region and a region is only reused once the GPU is done with it.
+    class StreamBuffer : public VertexBuffer
+    {
+    public:
+        StreamBuffer(uint32_t regionSize, uint32_t regions);
+        virtual ~StreamBuffer() = default;
+
+    public:
+        // Returns a CPU pointer and the offset of the data in the buffer,
+        // Data is nullptr if the size does not fit in what is left of the
+        // current region
+        StreamAllocation Allocate(uint32_t size, uint32_t alignment = 16);
+
+        // Fences the current region and moves to the next one, waiting
+        // until the GPU is done with it. Called once per frame, after the
+        // commands reading the region were submitted.
+        void Advance();
+
+        inline uint32_t GetRegionSize() const { return mRegionSize; }
+        inline uint32_t GetRegionCount() const { return mRegions; }
+        inline uint32_t GetCurrentRegion() const { return mCurrentRegion; }
+
+        // VertexBuffer commands, data is written through Allocate
+        virtual void Upload(uint32_t *data, uint32_t size) const override;
+        virtual void SetData(const void *data, uint32_t size) override;
+        virtual const BufferLayout &Layout() const override { return mLayout; }
+        virtual void SetLayout(const BufferLayout &layout) override { mLayout = layout; }
+
+    protected:
+        virtual uint8_t *GetMappedData() = 0;
+        virtual void PlaceFence(uint32_t region) = 0;
+        virtual void WaitFence(uint32_t region) = 0;
+
+    private:
+        uint32_t mRegionSize;
+        uint32_t mRegions;
+        uint32_t mCurrentRegion = 0;
+        uint32_t mRegionOffset = 0;
+        BufferLayout mLayout;
+
+    public:
+        static Ref<StreamBuffer> Create(uint32_t regionSize, uint32_t regions = 3);
+    };
+
+} // namespace Antomic
@@ -14,6 +14,7 @@
    limitations under the License.
 */
 #include "Renderer/Texture.h"
+#include "Renderer/CommandBuffer.h"
 #include "Platform/Platform.h"
 #include "Platform/RenderAPI.h"
 #include "Platform/NullRenderer/Texture.h"
@@ -23,16 +24,171 @@
 
 namespace Antomic
 {
-    Ref<Texture> Texture::CreateTexture(uint32_t width, uint32_t height, unsigned char *data)
+    static std::atomic<uint64_t> sAllocatedMemory{0};
+    static std::atomic<uint32_t> sAllocatedCount{0};
+
+    uint32_t TextureFormatChannels(TextureFormat format)
+    {
+        switch (format)
+        {
+        case TextureFormat::R8:
+            return 1;
+        case TextureFormat::RG8:
+            return 2;
+        case TextureFormat::RGB8:
+        case TextureFormat::SRGB8:
+            return 3;
+        case TextureFormat::RGBA8:
+        case TextureFormat::SRGBA8:
+        case TextureFormat::BC1:
+        case TextureFormat::BC1SRGB:
+        case TextureFormat::BC3:
+        case TextureFormat::BC3SRGB:
+        case TextureFormat::BC7:
+        case TextureFormat::BC7SRGB:
+            return 4;
+        case TextureFormat::BC4:
+            return 1;
+        case TextureFormat::BC5:
+            return 2;
+        }
+
+        ANTOMIC_ASSERT(false, "Unknown TextureFormat!");
+        return 0;
+    }
+
+    bool TextureFormatIsCompressed(TextureFormat format)
+    {
+        return format >= TextureFormat::BC1;
+    }
+
+    uint32_t TextureFormatSize(TextureFormat format)
+    {
+        switch (format)
+        {
+        case TextureFormat::BC1:
+        case TextureFormat::BC1SRGB:
+        case TextureFormat::BC4:
+            return 8;
+        case TextureFormat::BC3:
+        case TextureFormat::BC3SRGB:
+        case TextureFormat::BC5:
+        case TextureFormat::BC7:
+        case TextureFormat::BC7SRGB:
+            return 16;
+        default:
+            // The other formats use a byte per channel
+            return TextureFormatChannels(format);
+        }
+    }
+
+    TextureFormat TextureFormatFromChannels(uint32_t channels)
+    {
+        switch (channels)
+        {
+        case 1:
+            return TextureFormat::R8;
+        case 2:
+            return TextureFormat::RG8;
+        case 3:
+            return TextureFormat::RGB8;
+        default:
+            return TextureFormat::RGBA8;
+        }
+    }
+
+    /*************************************************************
+     * Texture Implementation
+     *************************************************************/
+
+    Texture::Texture(const TextureSpecification &specification)
+        : mSpecification(specification)
+    {
+        auto maxMips = GetMaxMipCount(specification.Width, specification.Height);
+        mMipCount = specification.Mips == 0 ? maxMips : std::min(specification.Mips, maxMips);
+        mMemorySize = GetMemorySize(specification.Width, specification.Height, specification.Format, mMipCount);
+
+        sAllocatedMemory += mMemorySize;
+        sAllocatedCount++;
+    }
+
+    Texture::~Texture()
+    {
+        sAllocatedMemory -= mMemorySize;
+        sAllocatedCount--;
+    }
+
+    void Texture::Record(CommandBuffer &commands) const
+    {
+        commands.BindTexture(this);
+    }
+
+    Ref<Texture> Texture::CreateTexture(const TextureSpecification &specification, unsigned char *data)
     {
         switch (Platform::GetRenderAPIDialect())
         {
 #ifdef ANTOMIC_GL_RENDERER
         case RenderAPIDialect::OPENGL:
-            return CreateRef<OpenGLTexture>(width, height, data);
+            return CreateRef<OpenGLTexture>(specification, data);
 #endif
         default:
-            return CreateRef<NullTexture>(width, height, data);
+            return CreateRef<NullTexture>(specification, data);
+        }
+    }
+
+    uint32_t Texture::GetMaxMipCount(uint32_t width, uint32_t height)
+    {
+        uint32_t mips = 1;
+        for (auto size = std::max(width, height); size > 1; size >>= 1)
+        {
+            mips++;
+        }
+        return mips;
+    }
+
+    uint64_t Texture::GetLevelSize(uint32_t width, uint32_t height, TextureFormat format, uint32_t level)
+    {
+        uint64_t levelWidth = std::max(1u, width >> level);
+        uint64_t levelHeight = std::max(1u, height >> level);
+
+        // Compressed levels are padded to whole blocks
+        if (TextureFormatIsCompressed(format))
+        {
+            levelWidth = (levelWidth + 3) / 4;
+            levelHeight = (levelHeight + 3) / 4;
         }
+
+        // Sizes read from file headers can overflow, they saturate instead
+        uint64_t texelSize = TextureFormatSize(format);
+        if (levelHeight > std::numeric_limits<uint64_t>::max() / levelWidth / texelSize)
+        {
+            return std::numeric_limits<uint64_t>::max();
+        }
+        return levelWidth * levelHeight * texelSize;
+    }
+
+    uint64_t Texture::GetMemorySize(uint32_t width, uint32_t height, TextureFormat format, uint32_t mips)
+    {
+        uint64_t size = 0;
+        for (uint32_t level = 0; level < mips; level++)
+        {
+            auto levelSize = GetLevelSize(width, height, format, level);
+            if (levelSize > std::numeric_limits<uint64_t>::max() - size)
+            {
+                return std::numeric_limits<uint64_t>::max();
+            }
+            size += levelSize;
+        }
+        return size;
+    }
+
+    uint64_t Texture::GetAllocatedMemory()
+    {
+        return sAllocatedMemory;
+    }
+
+    uint32_t Texture::GetAllocatedCount()
+    {
+        return sAllocatedCount;
     }
 } // namespace Antomic
@@ -19,13 +19,111 @@
 
 namespace Antomic
 {
+    enum class TextureFormat
+    {
+        R8,
+        RG8,
+        RGB8,
+        RGBA8,
+        SRGB8,
+        SRGBA8,
+
+        // Block compressed, 4x4 pixels per block
+        BC1,
+        BC1SRGB,
+        BC3,
+        BC3SRGB,
+        BC4,
+        BC5,
+        BC7,
+        BC7SRGB
+    };
+
+    enum class TextureFilter
+    {
+        Nearest,
+        Linear
+    };
+
+    enum class TextureWrap
+    {
+        Repeat,
+        MirroredRepeat,
+        ClampToEdge
+    };
+
+    uint32_t TextureFormatChannels(TextureFormat format);
+    bool TextureFormatIsCompressed(TextureFormat format);
+
+    // Bytes per pixel, or per block for compressed formats
+    uint32_t TextureFormatSize(TextureFormat format);
+
+    // Format used for images decoded with the given channel count
+    TextureFormat TextureFormatFromChannels(uint32_t channels);
+
+    /*************************************************************
+     * Texture Implementation
+     *************************************************************/
+
+    // Mips set to 0 allocates the full chain down to 1x1
+    struct TextureSpecification
+    {
+        uint32_t Width = 1;
+        uint32_t Height = 1;
+        TextureFormat Format = TextureFormat::RGBA8;
+        uint32_t Mips = 1;
+        TextureFilter Filter = TextureFilter::Linear;
+        TextureWrap Wrap = TextureWrap::Repeat;
+    };
+
     class Texture : public Bindable
     {
     public:
-        virtual ~Texture() = default;
+        virtual ~Texture();
+
+    public:
+        using Bindable::Bind;
+        virtual void Bind(uint32_t slot) const = 0;
+        virtual void Record(CommandBuffer &commands) const override;
+
+        // Pixels are tightly packed in the texture format
+        virtual void SetData(uint32_t x, uint32_t y, uint32_t width, uint32_t height, unsigned char *data) = 0;
+
+        // Uploads a whole mip level of a compressed texture
+        virtual void SetCompressedData(uint32_t level, const unsigned char *data, uint32_t size) = 0;
+
+        // Uploads pixels written to a staging buffer, starting at offset.
+        // The copy runs on the GPU, the CPU only records it.
+        virtual void SetData(uint32_t x, uint32_t y, uint32_t width, uint32_t height, const StreamBuffer &staging, uint32_t offset) = 0;
+
+        inline const TextureSpecification &GetSpecification() const { return mSpecification; }
+        inline uint32_t GetWidth() const { return mSpecification.Width; }
+        inline uint32_t GetHeight() const { return mSpecification.Height; }
+        inline TextureFormat GetFormat() const { return mSpecification.Format; }
+        inline uint32_t GetMipCount() const { return mMipCount; }
+
+        // Bytes of storage allocated for all the mip levels
+        inline uint64_t GetMemorySize() const { return mMemorySize; }
 
     public:
-        static Ref<Texture> CreateTexture(uint32_t width, uint32_t height, unsigned char* data);
+        // Data fills the base level, mips are generated from it
+        static Ref<Texture> CreateTexture(const TextureSpecification &specification, unsigned char *data = nullptr);
+
+        static uint32_t GetMaxMipCount(uint32_t width, uint32_t height);
+        static uint64_t GetLevelSize(uint32_t width, uint32_t height, TextureFormat format, uint32_t level);
+        static uint64_t GetMemorySize(uint32_t width, uint32_t height, TextureFormat format, uint32_t mips);
+
+        // Sum of the storage of every live texture
+        static uint64_t GetAllocatedMemory();
+        static uint32_t GetAllocatedCount();
+
+    protected:
+        Texture(const TextureSpecification &specification);
+
+    protected:
+        TextureSpecification mSpecification;
+        uint32_t mMipCount;
+        uint64_t mMemorySize;
     };
     
 } // namespace Antomic
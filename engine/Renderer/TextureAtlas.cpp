@@ -0,0 +1,292 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "Renderer/TextureAtlas.h"
+#include "Renderer/Texture.h"
+#include "Core/Log.h"
+#include "Profiling/Instrumentor.h"
+
+namespace Antomic
+{
+    /*************************************************************
+     * SkylinePacker Implementation
+     *************************************************************/
+
+    SkylinePacker::SkylinePacker(uint32_t width, uint32_t height)
+        : mWidth(width), mHeight(height)
+    {
+        Reset();
+    }
+
+    void SkylinePacker::Reset()
+    {
+        mSkyline.clear();
+        mSkyline.push_back({0, 0, mWidth});
+        mUsedArea = 0;
+    }
+
+    bool SkylinePacker::Fits(size_t index, uint32_t width, uint32_t height, uint32_t &y) const
+    {
+        auto x = mSkyline[index].X;
+        if (x + width > mWidth)
+        {
+            return false;
+        }
+
+        // The rectangle rests on the highest segment it spans
+        y = mSkyline[index].Y;
+        uint32_t widthLeft = width;
+        while (widthLeft > 0)
+        {
+            y = std::max(y, mSkyline[index].Y);
+            if (y + height > mHeight)
+            {
+                return false;
+            }
+
+            if (mSkyline[index].Width >= widthLeft)
+            {
+                break;
+            }
+
+            widthLeft -= mSkyline[index].Width;
+            index++;
+        }
+
+        return true;
+    }
+
+    void SkylinePacker::AddSegment(size_t index, const PackedRect &rect)
+    {
+        mSkyline.insert(mSkyline.begin() + index, {rect.X, rect.Y + rect.Height, rect.Width});
+
+        // Shrink or remove the segments now covered by the new one
+        for (auto i = index + 1; i < mSkyline.size();)
+        {
+            auto &previous = mSkyline[i - 1];
+            auto &current = mSkyline[i];
+            auto previousEnd = previous.X + previous.Width;
+
+            if (current.X >= previousEnd)
+            {
+                break;
+            }
+
+            auto shrink = previousEnd - current.X;
+            if (current.Width <= shrink)
+            {
+                mSkyline.erase(mSkyline.begin() + i);
+                continue;
+            }
+
+            current.X += shrink;
+            current.Width -= shrink;
+            break;
+        }
+
+        // Merge neighbour segments at the same height
+        for (size_t i = 0; i + 1 < mSkyline.size();)
+        {
+            if (mSkyline[i].Y == mSkyline[i + 1].Y)
+            {
+                mSkyline[i].Width += mSkyline[i + 1].Width;
+                mSkyline.erase(mSkyline.begin() + i + 1);
+                continue;
+            }
+            i++;
+        }
+    }
+
+    bool SkylinePacker::Pack(uint32_t width, uint32_t height, PackedRect &rect)
+    {
+        if (width == 0 || height == 0 || width > mWidth || height > mHeight)
+        {
+            return false;
+        }
+
+        // Pick the position with the lowest top edge, ties go to the
+        // narrowest segment to keep wide segments for wide rectangles
+        auto bestIndex = mSkyline.size();
+        uint32_t bestTop = std::numeric_limits<uint32_t>::max();
+        uint32_t bestWidth = std::numeric_limits<uint32_t>::max();
+
+        for (size_t i = 0; i < mSkyline.size(); i++)
+        {
+            uint32_t y;
+            if (!Fits(i, width, height, y))
+            {
+                continue;
+            }
+
+            auto top = y + height;
+            if (top < bestTop || (top == bestTop && mSkyline[i].Width < bestWidth))
+            {
+                bestIndex = i;
+                bestTop = top;
+                bestWidth = mSkyline[i].Width;
+                rect = {mSkyline[i].X, y, width, height};
+            }
+        }
+
+        if (bestIndex == mSkyline.size())
+        {
+            return false;
+        }
+
+        AddSegment(bestIndex, rect);
+        mUsedArea += (uint64_t)width * height;
+        return true;
+    }
+
+    /*************************************************************
+     * TextureAtlas Implementation
+     *************************************************************/
+
+    TextureAtlasPage::TextureAtlasPage(uint32_t width, uint32_t height)
+        : mPacker(width, height)
+    {
+        // Mips would bleed between regions, pages only have the base level.
+        // Storage starts undefined, the gaps between regions are cleared.
+        TextureSpecification specification;
+        specification.Width = width;
+        specification.Height = height;
+        specification.Format = TextureFormat::RGBA8;
+        specification.Wrap = TextureWrap::ClampToEdge;
+        std::vector<unsigned char> clear((size_t)width * height * TextureFormatSize(specification.Format), 0);
+        mTexture = Texture::CreateTexture(specification, clear.data());
+    }
+
+    TextureAtlas::TextureAtlas(uint32_t pageSize, uint32_t padding)
+        : mPageSize(pageSize), mPadding(padding)
+    {
+    }
+
+    Ref<TextureRegion> TextureAtlas::Find(const std::string &name)
+    {
+        auto it = mRegions.find(name);
+        if (it == mRegions.end())
+        {
+            return nullptr;
+        }
+
+        auto region = it->second.lock();
+        if (region == nullptr)
+        {
+            mRegions.erase(it);
+        }
+        return region;
+    }
+
+    Ref<TextureRegion> TextureAtlas::Add(const std::string &name, uint32_t width, uint32_t height, unsigned char *data)
+    {
+        ANTOMIC_PROFILE_FUNCTION("Renderer");
+
+        PackedRect rect;
+        auto region = Reserve(name, width, height, rect);
+        if (region != nullptr)
+        {
+            auto padded = Pad(width, height, data, mPadding);
+            region->GetTexture()->SetData(rect.X, rect.Y, rect.Width, rect.Height, padded.data());
+        }
+        return region;
+    }
+
+    Ref<TextureRegion> TextureAtlas::Reserve(const std::string &name, uint32_t width, uint32_t height, PackedRect &rect)
+    {
+        if (!Fits(width, height))
+        {
+            return nullptr;
+        }
+
+        auto paddedWidth = width + 2 * mPadding;
+        auto paddedHeight = height + 2 * mPadding;
+
+        Ref<TextureAtlasPage> page = nullptr;
+
+        for (auto &candidate : mPages)
+        {
+            // Pages only referenced by the atlas are empty, start them over
+            if (candidate.use_count() == 1)
+            {
+                candidate->GetPacker().Reset();
+            }
+
+            if (candidate->GetPacker().Pack(paddedWidth, paddedHeight, rect))
+            {
+                page = candidate;
+                break;
+            }
+        }
+
+        // Grow the atlas with a new page
+        if (page == nullptr)
+        {
+            page = CreateRef<TextureAtlasPage>(mPageSize, mPageSize);
+            page->GetPacker().Pack(paddedWidth, paddedHeight, rect);
+            mPages.push_back(page);
+        }
+
+        auto size = (float)mPageSize;
+        auto x = rect.X + mPadding;
+        auto y = rect.Y + mPadding;
+        auto region = CreateRef<TextureRegion>(page, glm::vec4(x / size, y / size, (x + width) / size, (y + height) / size));
+        mRegions[name] = region;
+        return region;
+    }
+
+    std::vector<uint8_t> TextureAtlas::Pad(uint32_t width, uint32_t height, const unsigned char *data, uint32_t padding)
+    {
+        const uint32_t texel = 4;
+        auto paddedWidth = width + 2 * padding;
+        auto paddedHeight = height + 2 * padding;
+        std::vector<uint8_t> padded((size_t)paddedWidth * paddedHeight * texel);
+        for (uint32_t y = 0; y < paddedHeight; y++)
+        {
+            // Rows and columns past the border repeat the closest one
+            auto row = (uint32_t)std::clamp<int64_t>((int64_t)y - padding, 0, height - 1);
+            auto source = data + (size_t)row * width * texel;
+            auto target = padded.data() + (size_t)y * paddedWidth * texel;
+            for (uint32_t x = 0; x < padding; x++)
+            {
+                std::memcpy(target + x * texel, source, texel);
+                std::memcpy(target + (padding + width + x) * texel, source + (width - 1) * texel, texel);
+            }
+            std::memcpy(target + padding * texel, source, (size_t)width * texel);
+        }
+        return padded;
+    }
+
+    void TextureAtlas::Evict()
+    {
+        ANTOMIC_PROFILE_FUNCTION("Renderer");
+
+        auto unused = [](const Ref<TextureAtlasPage> &page) -> bool {
+            return page.use_count() == 1;
+        };
+        mPages.erase(std::remove_if(mPages.begin(), mPages.end(), unused), mPages.end());
+
+        for (auto it = mRegions.begin(); it != mRegions.end();)
+        {
+            it = it->second.expired() ? mRegions.erase(it) : std::next(it);
+        }
+    }
+
+    TextureAtlas &TextureAtlas::Get()
+    {
+        static TextureAtlas instance;
+        return instance;
+    }
+
+} // namespace Antomic
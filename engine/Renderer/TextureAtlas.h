@@ -0,0 +1,151 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+#include "Core/Base.h"
+#include "glm/glm.hpp"
+
+namespace Antomic
+{
+    /*************************************************************
+     * SkylinePacker Implementation
+     *************************************************************/
+
+    struct PackedRect
+    {
+        uint32_t X;
+        uint32_t Y;
+        uint32_t Width;
+        uint32_t Height;
+    };
+
+    // Bottom-left skyline bin packer, the skyline keeps the top edge of the
+    // packed rectangles as a list of horizontal segments, new rectangles are
+    // placed on the segment that leaves them lowest.
+    class SkylinePacker
+    {
+    public:
+        SkylinePacker(uint32_t width, uint32_t height);
+        ~SkylinePacker() = default;
+
+    public:
+        bool Pack(uint32_t width, uint32_t height, PackedRect &rect);
+        void Reset();
+
+        inline uint32_t GetWidth() const { return mWidth; }
+        inline uint32_t GetHeight() const { return mHeight; }
+        inline uint64_t GetUsedArea() const { return mUsedArea; }
+
+    private:
+        bool Fits(size_t index, uint32_t width, uint32_t height, uint32_t &y) const;
+        void AddSegment(size_t index, const PackedRect &rect);
+
+    private:
+        struct Segment
+        {
+            uint32_t X;
+            uint32_t Y;
+            uint32_t Width;
+        };
+
+        uint32_t mWidth;
+        uint32_t mHeight;
+        uint64_t mUsedArea = 0;
+        std::vector<Segment> mSkyline;
+    };
+
+    /*************************************************************
+     * TextureAtlas Implementation
+     *************************************************************/
+
+    class TextureAtlasPage
+    {
+    public:
+        TextureAtlasPage(uint32_t width, uint32_t height);
+        ~TextureAtlasPage() = default;
+
+    public:
+        inline const Ref<Texture> &GetTexture() const { return mTexture; }
+        inline SkylinePacker &GetPacker() { return mPacker; }
+
+    private:
+        Ref<Texture> mTexture;
+        SkylinePacker mPacker;
+    };
+
+    // A region keeps its page alive, a page with no regions left can be
+    // recycled or evicted by the atlas. Images too big for a page get a
+    // region covering a texture of their own.
+    class TextureRegion
+    {
+    public:
+        TextureRegion(const Ref<TextureAtlasPage> &page, const glm::vec4 &rect) : mPage(page), mTexture(page->GetTexture()), mRect(rect) {}
+        TextureRegion(const Ref<Texture> &texture) : mTexture(texture), mRect(0.0f, 0.0f, 1.0f, 1.0f) {}
+        ~TextureRegion() = default;
+
+    public:
+        inline const Ref<Texture> &GetTexture() const { return mTexture; }
+        inline const glm::vec4 &GetRect() const { return mRect; }
+
+    private:
+        Ref<TextureAtlasPage> mPage;
+        Ref<Texture> mTexture;
+        glm::vec4 mRect;
+    };
+
+    class TextureAtlas
+    {
+    public:
+        TextureAtlas(uint32_t pageSize = 2048, uint32_t padding = 1);
+        ~TextureAtlas() = default;
+
+    public:
+        // Returns an existing region for the given name if still in use
+        Ref<TextureRegion> Find(const std::string &name);
+
+        // Packs an RGBA image into one of the pages, returns nullptr if the
+        // image does not fit in a page
+        Ref<TextureRegion> Add(const std::string &name, uint32_t width, uint32_t height, unsigned char *data);
+
+        // Packs an image without uploading it. Rect receives the padded
+        // area, the pixels uploaded there come from Pad. Returns nullptr if
+        // the image does not fit in a page
+        Ref<TextureRegion> Reserve(const std::string &name, uint32_t width, uint32_t height, PackedRect &rect);
+
+        // Whether an image of the given size fits in a page at all
+        inline bool Fits(uint32_t width, uint32_t height) const { return width + 2 * mPadding <= mPageSize && height + 2 * mPadding <= mPageSize; }
+
+        // Regions are surrounded by padding texels on every side, a copy of
+        // the image border so filtering at the edges never reads a neighbour
+        static std::vector<uint8_t> Pad(uint32_t width, uint32_t height, const unsigned char *data, uint32_t padding);
+        inline uint32_t GetPadding() const { return mPadding; }
+
+        // Releases pages without any region in use
+        void Evict();
+
+        inline size_t GetPageCount() const { return mPages.size(); }
+        inline uint32_t GetPageSize() const { return mPageSize; }
+
+    public:
+        static TextureAtlas &Get();
+
+    private:
+        uint32_t mPageSize;
+        uint32_t mPadding;
+        VectorRef<TextureAtlasPage> mPages;
+        std::unordered_map<std::string, std::weak_ptr<TextureRegion>> mRegions;
+    };
+
+} // namespace Antomic
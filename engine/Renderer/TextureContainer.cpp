@@ -0,0 +1,308 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "enginepch.h"
+#include "Renderer/TextureContainer.h"
+#include "Core/Archive.h"
+#include "Profiling/Instrumentor.h"
+
+namespace Antomic
+{
+    static const uint8_t sKTX2Identifier[12] = {0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'};
+    static const uint32_t sKTX2HeaderSize = 80;
+    static const uint32_t sKTX2LevelSize = 24;
+
+    static const uint32_t sDDSMagic = 0x20534444; // "DDS "
+    static const uint32_t sDDSHeaderSize = 128;
+    static const uint32_t sDDSExtendedSize = 20;
+
+    static constexpr uint32_t FourCC(char a, char b, char c, char d)
+    {
+        return (uint32_t)a | ((uint32_t)b << 8) | ((uint32_t)c << 16) | ((uint32_t)d << 24);
+    }
+
+    // Containers are little endian, as every platform the engine runs on
+    template <typename T>
+    static T Read(const uint8_t *data, size_t offset)
+    {
+        T value;
+        std::memcpy(&value, data + offset, sizeof(T));
+        return value;
+    }
+
+    static bool FormatFromVulkan(uint32_t vkFormat, TextureFormat &format)
+    {
+        switch (vkFormat)
+        {
+        case 131: // VK_FORMAT_BC1_RGB_UNORM_BLOCK
+        case 133: // VK_FORMAT_BC1_RGBA_UNORM_BLOCK
+            format = TextureFormat::BC1;
+            return true;
+        case 132: // VK_FORMAT_BC1_RGB_SRGB_BLOCK
+        case 134: // VK_FORMAT_BC1_RGBA_SRGB_BLOCK
+            format = TextureFormat::BC1SRGB;
+            return true;
+        case 137: // VK_FORMAT_BC3_UNORM_BLOCK
+            format = TextureFormat::BC3;
+            return true;
+        case 138: // VK_FORMAT_BC3_SRGB_BLOCK
+            format = TextureFormat::BC3SRGB;
+            return true;
+        case 139: // VK_FORMAT_BC4_UNORM_BLOCK
+            format = TextureFormat::BC4;
+            return true;
+        case 141: // VK_FORMAT_BC5_UNORM_BLOCK
+            format = TextureFormat::BC5;
+            return true;
+        case 145: // VK_FORMAT_BC7_UNORM_BLOCK
+            format = TextureFormat::BC7;
+            return true;
+        case 146: // VK_FORMAT_BC7_SRGB_BLOCK
+            format = TextureFormat::BC7SRGB;
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    static bool FormatFromDXGI(uint32_t dxgiFormat, TextureFormat &format)
+    {
+        switch (dxgiFormat)
+        {
+        case 71: // DXGI_FORMAT_BC1_UNORM
+            format = TextureFormat::BC1;
+            return true;
+        case 72: // DXGI_FORMAT_BC1_UNORM_SRGB
+            format = TextureFormat::BC1SRGB;
+            return true;
+        case 77: // DXGI_FORMAT_BC3_UNORM
+            format = TextureFormat::BC3;
+            return true;
+        case 78: // DXGI_FORMAT_BC3_UNORM_SRGB
+            format = TextureFormat::BC3SRGB;
+            return true;
+        case 80: // DXGI_FORMAT_BC4_UNORM
+            format = TextureFormat::BC4;
+            return true;
+        case 83: // DXGI_FORMAT_BC5_UNORM
+            format = TextureFormat::BC5;
+            return true;
+        case 98: // DXGI_FORMAT_BC7_UNORM
+            format = TextureFormat::BC7;
+            return true;
+        case 99: // DXGI_FORMAT_BC7_UNORM_SRGB
+            format = TextureFormat::BC7SRGB;
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    static bool FormatFromFourCC(uint32_t fourCC, TextureFormat &format)
+    {
+        switch (fourCC)
+        {
+        case FourCC('D', 'X', 'T', '1'):
+            format = TextureFormat::BC1;
+            return true;
+        case FourCC('D', 'X', 'T', '5'):
+            format = TextureFormat::BC3;
+            return true;
+        case FourCC('A', 'T', 'I', '1'):
+        case FourCC('B', 'C', '4', 'U'):
+            format = TextureFormat::BC4;
+            return true;
+        case FourCC('A', 'T', 'I', '2'):
+        case FourCC('B', 'C', '5', 'U'):
+            format = TextureFormat::BC5;
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    bool TextureContainer::IsContainer(const std::string &path)
+    {
+        auto extension = std::filesystem::path(path).extension().string();
+        std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return std::tolower(c); });
+        return extension == ".ktx2" || extension == ".dds";
+    }
+
+    bool TextureContainer::Load(const std::string &path, TextureImage &image)
+    {
+        ANTOMIC_PROFILE_FUNCTION("Renderer");
+
+        // Archived files are parsed in place
+        auto blob = Archive::Resolve(path);
+        if (blob.IsValid())
+        {
+            return Parse(blob.Data, blob.Size, image);
+        }
+
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file)
+        {
+            return false;
+        }
+
+        std::vector<uint8_t> data((size_t)file.tellg());
+        file.seekg(0);
+        if (!file.read((char *)data.data(), data.size()))
+        {
+            return false;
+        }
+
+        return Parse(data.data(), data.size(), image);
+    }
+
+    bool TextureContainer::Parse(const uint8_t *data, size_t size, TextureImage &image)
+    {
+        if (size >= sizeof(sKTX2Identifier) && std::memcmp(data, sKTX2Identifier, sizeof(sKTX2Identifier)) == 0)
+        {
+            return ParseKTX2(data, size, image);
+        }
+
+        if (size >= sizeof(uint32_t) && Read<uint32_t>(data, 0) == sDDSMagic)
+        {
+            return ParseDDS(data, size, image);
+        }
+
+        return false;
+    }
+
+    bool TextureContainer::ParseKTX2(const uint8_t *data, size_t size, TextureImage &image)
+    {
+        if (size < sKTX2HeaderSize)
+        {
+            return false;
+        }
+
+        auto vkFormat = Read<uint32_t>(data, 12);
+        auto width = Read<uint32_t>(data, 20);
+        auto height = Read<uint32_t>(data, 24);
+        auto depth = Read<uint32_t>(data, 28);
+        auto levels = std::max(1u, Read<uint32_t>(data, 40));
+        auto supercompression = Read<uint32_t>(data, 44);
+
+        auto &specification = image.Specification;
+        if (!FormatFromVulkan(vkFormat, specification.Format) || supercompression != 0 || depth > 1 ||
+            width == 0 || height == 0 || levels > Texture::GetMaxMipCount(width, height))
+        {
+            return false;
+        }
+
+        if (size < sKTX2HeaderSize + (size_t)levels * sKTX2LevelSize)
+        {
+            return false;
+        }
+
+        specification.Width = width;
+        specification.Height = height;
+        specification.Mips = levels;
+
+        // The level index lists level 0 first, whatever the order in the file.
+        // Array layers and faces follow the first one within each level
+        std::vector<size_t> offsets;
+        for (uint32_t level = 0; level < levels; level++)
+        {
+            offsets.push_back(Read<uint64_t>(data, sKTX2HeaderSize + level * sKTX2LevelSize));
+        }
+
+        return AddLevels(data, size, offsets, image);
+    }
+
+    bool TextureContainer::ParseDDS(const uint8_t *data, size_t size, TextureImage &image)
+    {
+        if (size < sDDSHeaderSize)
+        {
+            return false;
+        }
+
+        auto height = Read<uint32_t>(data, 12);
+        auto width = Read<uint32_t>(data, 16);
+        auto levels = std::max(1u, Read<uint32_t>(data, 28));
+        auto fourCC = Read<uint32_t>(data, 84);
+
+        auto &specification = image.Specification;
+        size_t offset = sDDSHeaderSize;
+        if (fourCC == FourCC('D', 'X', '1', '0'))
+        {
+            if (size < sDDSHeaderSize + sDDSExtendedSize || !FormatFromDXGI(Read<uint32_t>(data, sDDSHeaderSize), specification.Format))
+            {
+                return false;
+            }
+            offset += sDDSExtendedSize;
+        }
+        else if (!FormatFromFourCC(fourCC, specification.Format))
+        {
+            return false;
+        }
+
+        if (width == 0 || height == 0 || levels > Texture::GetMaxMipCount(width, height))
+        {
+            return false;
+        }
+
+        specification.Width = width;
+        specification.Height = height;
+        specification.Mips = levels;
+
+        // Levels are stored back to back, the first array layer comes first
+        std::vector<size_t> offsets;
+        for (uint32_t level = 0; level < levels; level++)
+        {
+            offsets.push_back(offset);
+            offset += Texture::GetLevelSize(width, height, specification.Format, level);
+        }
+
+        return AddLevels(data, size, offsets, image);
+    }
+
+    bool TextureContainer::AddLevels(const uint8_t *data, size_t size, const std::vector<size_t> &offsets, TextureImage &image)
+    {
+        auto &specification = image.Specification;
+        image.Levels.clear();
+        image.Data.clear();
+
+        // Dimensions come from the header, every level is checked against
+        // the file before anything is allocated for them
+        uint64_t total = 0;
+        for (uint32_t level = 0; level < offsets.size(); level++)
+        {
+            auto levelSize = Texture::GetLevelSize(specification.Width, specification.Height, specification.Format, level);
+            if (offsets[level] > size || levelSize > size - offsets[level])
+            {
+                return false;
+            }
+            total += levelSize;
+        }
+        image.Data.reserve(total);
+
+        for (uint32_t level = 0; level < offsets.size(); level++)
+        {
+            auto levelSize = Texture::GetLevelSize(specification.Width, specification.Height, specification.Format, level);
+            TextureLevel entry;
+            entry.Width = std::max(1u, specification.Width >> level);
+            entry.Height = std::max(1u, specification.Height >> level);
+            entry.Offset = image.Data.size();
+            entry.Size = levelSize;
+            image.Levels.push_back(entry);
+            image.Data.insert(image.Data.end(), data + offsets[level], data + offsets[level] + levelSize);
+        }
+
+        return true;
+    }
+
+} // namespace Antomic
@@ -0,0 +1,59 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+#include "Core/Base.h"
+#include "Renderer/Texture.h"
+
+namespace Antomic
+{
+    struct TextureLevel
+    {
+        uint32_t Width;
+        uint32_t Height;
+        size_t Offset;
+        size_t Size;
+    };
+
+    // Pre-built image, every mip level stored back to back in Data
+    struct TextureImage
+    {
+        TextureSpecification Specification;
+        std::vector<TextureLevel> Levels;
+        std::vector<uint8_t> Data;
+    };
+
+    /*************************************************************
+     * TextureContainer Implementation
+     *************************************************************/
+
+    // Reads block compressed 2D textures from KTX2 and DDS files. Only the
+    // first layer or face is kept, supercompressed KTX2 is not supported.
+    class TextureContainer
+    {
+    public:
+        // Whether the path names a container rather than an image to decode
+        static bool IsContainer(const std::string &path);
+
+        static bool Load(const std::string &path, TextureImage &image);
+        static bool Parse(const uint8_t *data, size_t size, TextureImage &image);
+
+    private:
+        static bool ParseKTX2(const uint8_t *data, size_t size, TextureImage &image);
+        static bool ParseDDS(const uint8_t *data, size_t size, TextureImage &image);
+        static bool AddLevels(const uint8_t *data, size_t size, const std::vector<size_t> &offsets, TextureImage &image);
+    };
+
+} // namespace Antomic
@@ -0,0 +1,346 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "enginepch.h"
+#include "Renderer/TextureLoader.h"
+#include "Core/Archive.h"
+#include "Renderer/Texture.h"
+#include "Renderer/TextureAtlas.h"
+#include "Renderer/TextureContainer.h"
+#include "Renderer/StreamBuffer.h"
+#include "Profiling/Instrumentor.h"
+#include "stb_image.h"
+
+namespace Antomic
+{
+    // Staging regions in flight, the same count the stream buffers use
+    static const uint32_t sStagingRegions = 3;
+
+    TextureLoader::TextureLoader(uint32_t workers, uint32_t uploadBudget)
+        : mAtlas(TextureAtlas::Get()), mWorkerCount(std::max(1u, workers)), mUploadBudget(uploadBudget)
+    {
+    }
+
+    TextureLoader::~TextureLoader()
+    {
+        Shutdown();
+    }
+
+    void TextureLoader::Load(const std::string &name, const TextureLoadedCallback &callback)
+    {
+        Ref<TextureRegion> region = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            auto resident = mResident.find(name);
+            if (resident != mResident.end())
+            {
+                region = resident->second.lock();
+                if (region == nullptr)
+                {
+                    mResident.erase(resident);
+                }
+            }
+
+            if (region == nullptr)
+            {
+                auto pending = mPending.find(name);
+                if (pending != mPending.end())
+                {
+                    pending->second->Callbacks.push_back(callback);
+                    return;
+                }
+
+                auto request = CreateRef<Request>();
+                request->Name = name;
+                request->Callbacks.push_back(callback);
+                mPending[name] = request;
+                mDecodeQueue.push(request);
+
+                if (!mRunning)
+                {
+                    Start();
+                }
+            }
+        }
+
+        if (region != nullptr)
+        {
+            callback(region);
+            return;
+        }
+
+        mWorkReady.notify_one();
+    }
+
+    void TextureLoader::Start()
+    {
+        mRunning = true;
+        for (uint32_t i = 0; i < mWorkerCount; i++)
+        {
+            mWorkers.emplace_back(&TextureLoader::Run, this);
+        }
+    }
+
+    void TextureLoader::Run()
+    {
+        while (true)
+        {
+            Ref<Request> request;
+            {
+                std::unique_lock<std::mutex> lock(mMutex);
+                mWorkReady.wait(lock, [this]() { return !mRunning || !mDecodeQueue.empty(); });
+                if (!mRunning)
+                {
+                    return;
+                }
+
+                request = mDecodeQueue.front();
+                mDecodeQueue.pop();
+            }
+
+            // Containers are uploaded as they are, with their own mips
+            TextureImage image;
+            if (TextureContainer::IsContainer(request->Name))
+            {
+                if (TextureContainer::Load(request->Name, image))
+                {
+                    request->Format = image.Specification.Format;
+                    request->Width = image.Specification.Width;
+                    request->Height = image.Specification.Height;
+                    request->Levels = std::move(image.Levels);
+                    request->Pixels = std::move(image.Data);
+                }
+            }
+            else
+            {
+                Decode(*request);
+            }
+
+            std::lock_guard<std::mutex> lock(mMutex);
+            mUploadQueue.push(request);
+        }
+    }
+
+    void TextureLoader::Decode(Request &request)
+    {
+        // Archived images are decoded straight from the mapping
+        int width, height, channels;
+        auto blob = Archive::Resolve(request.Name);
+        auto size = (int)blob.Size;
+        auto found = blob.IsValid() ? stbi_info_from_memory(blob.Data, size, &width, &height, &channels)
+                                    : stbi_info(request.Name.c_str(), &width, &height, &channels);
+        if (!found)
+        {
+            return;
+        }
+
+        // Images going to the atlas are expanded to its RGBA pages, the rest
+        // keep their own channels
+        request.Packed = mAtlas.Fits(width, height);
+        auto desired = request.Packed ? 4 : 0;
+        auto data = blob.IsValid() ? stbi_load_from_memory(blob.Data, size, &width, &height, &channels, desired)
+                                   : stbi_load(request.Name.c_str(), &width, &height, &channels, desired);
+        if (data == nullptr)
+        {
+            return;
+        }
+
+        request.Format = request.Packed ? TextureFormat::RGBA8 : TextureFormatFromChannels(channels);
+        request.Width = width;
+        request.Height = height;
+        if (request.Packed)
+        {
+            request.Pixels = TextureAtlas::Pad(width, height, data, mAtlas.GetPadding());
+        }
+        else
+        {
+            request.Pixels.assign(data, data + (size_t)width * height * TextureFormatSize(request.Format));
+        }
+        stbi_image_free(data);
+    }
+
+    void TextureLoader::Upload()
+    {
+        ANTOMIC_PROFILE_FUNCTION("Renderer");
+
+        // At least one image per frame, even when it is over the budget
+        std::vector<Ref<Request>> uploads;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            uint64_t bytes = 0;
+            while (!mUploadQueue.empty())
+            {
+                auto size = mUploadQueue.front()->Pixels.size();
+                if (!uploads.empty() && bytes + size > mUploadBudget)
+                {
+                    break;
+                }
+
+                bytes += size;
+                uploads.push_back(mUploadQueue.front());
+                mUploadQueue.pop();
+            }
+        }
+
+        if (uploads.empty())
+        {
+            return;
+        }
+
+        for (auto &request : uploads)
+        {
+            if (!request->Pixels.empty())
+            {
+                request->Region = UploadImage(*request);
+            }
+            std::vector<uint8_t>().swap(request->Pixels);
+        }
+
+        // Fences this frame's copies, the region is reused once they are done
+        if (mStaging != nullptr)
+        {
+            mStaging->Advance();
+        }
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        mCompleted.insert(mCompleted.end(), uploads.begin(), uploads.end());
+    }
+
+    Ref<TextureRegion> TextureLoader::UploadImage(Request &request)
+    {
+        if (!request.Levels.empty())
+        {
+            return UploadLevels(request);
+        }
+
+        if (mStaging == nullptr)
+        {
+            mStaging = StreamBuffer::Create(mUploadBudget, sStagingRegions);
+        }
+
+        // Too big for an atlas page, use a texture of its own with mips.
+        // Packed images were padded by the workers to the reserved rect.
+        PackedRect rect = {0, 0, request.Width, request.Height};
+        Ref<TextureRegion> region = nullptr;
+        if (request.Packed)
+        {
+            region = mAtlas.Reserve(request.Name, request.Width, request.Height, rect);
+        }
+        else
+        {
+            TextureSpecification specification;
+            specification.Width = request.Width;
+            specification.Height = request.Height;
+            specification.Format = request.Format;
+            specification.Mips = 0;
+            region = CreateRef<TextureRegion>(Texture::CreateTexture(specification));
+        }
+
+        // Images larger than the staging buffer are uploaded directly
+        auto &texture = region->GetTexture();
+        auto allocation = mStaging->Allocate((uint32_t)request.Pixels.size(), 4);
+        if (allocation.Data == nullptr)
+        {
+            texture->SetData(rect.X, rect.Y, rect.Width, rect.Height, request.Pixels.data());
+            return region;
+        }
+
+        std::memcpy(allocation.Data, request.Pixels.data(), request.Pixels.size());
+        texture->SetData(rect.X, rect.Y, rect.Width, rect.Height, *mStaging, allocation.Offset);
+        return region;
+    }
+
+    Ref<TextureRegion> TextureLoader::UploadLevels(Request &request)
+    {
+        TextureSpecification specification;
+        specification.Width = request.Width;
+        specification.Height = request.Height;
+        specification.Format = request.Format;
+        specification.Mips = (uint32_t)request.Levels.size();
+
+        // Compressed levels are small, they skip the staging buffer
+        auto texture = Texture::CreateTexture(specification);
+        for (uint32_t level = 0; level < request.Levels.size(); level++)
+        {
+            auto &entry = request.Levels[level];
+            texture->SetCompressedData(level, request.Pixels.data() + entry.Offset, (uint32_t)entry.Size);
+        }
+        return CreateRef<TextureRegion>(texture);
+    }
+
+    void TextureLoader::Dispatch()
+    {
+        ANTOMIC_PROFILE_FUNCTION("Renderer");
+
+        std::vector<Ref<Request>> completed;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            completed.swap(mCompleted);
+            for (auto &request : completed)
+            {
+                mPending.erase(request->Name);
+                if (request->Region != nullptr)
+                {
+                    mResident[request->Name] = request->Region;
+                }
+            }
+        }
+
+        for (auto &request : completed)
+        {
+            for (auto &callback : request->Callbacks)
+            {
+                callback(request->Region);
+            }
+        }
+    }
+
+    void TextureLoader::Shutdown()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mRunning = false;
+        }
+        mWorkReady.notify_all();
+
+        for (auto &worker : mWorkers)
+        {
+            worker.join();
+        }
+        mWorkers.clear();
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        mPending.clear();
+        mDecodeQueue = {};
+        mUploadQueue = {};
+        mCompleted.clear();
+        mResident.clear();
+        mStaging = nullptr;
+    }
+
+    uint32_t TextureLoader::GetPendingCount()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return (uint32_t)mPending.size();
+    }
+
+    TextureLoader &TextureLoader::Get()
+    {
+        static TextureLoader instance;
+        return instance;
+    }
+
+} // namespace Antomic
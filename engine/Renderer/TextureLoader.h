@@ -0,0 +1,105 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+#include "Core/Base.h"
+#include "Renderer/Texture.h"
+#include "Renderer/TextureContainer.h"
+
+namespace Antomic
+{
+    // Called once the image is resident, the region is nullptr if the
+    // image could not be decoded
+    using TextureLoadedCallback = std::function<void(const Ref<TextureRegion> &)>;
+
+    /*************************************************************
+     * TextureLoader Implementation
+     *************************************************************/
+
+    // Loads images off the main thread, KTX2 and DDS files are uploaded
+    // compressed as they are. Workers decode the files, the render
+    // thread copies the pixels to a staging buffer and uploads them within a
+    // per frame byte budget, the main thread then runs the callbacks. Until
+    // then sprites keep the placeholder, Render2d binds a white texture for
+    // sprites without one.
+    class TextureLoader
+    {
+    public:
+        TextureLoader(uint32_t workers = 2, uint32_t uploadBudget = 4 * 1024 * 1024);
+        ~TextureLoader();
+
+    public:
+        // Main thread, requests for the same image share one decode. Images
+        // still resident call back right away.
+        void Load(const std::string &name, const TextureLoadedCallback &callback);
+
+        // Render thread, uploads decoded images within the budget
+        void Upload();
+
+        // Main thread, runs the callbacks of the images made resident
+        void Dispatch();
+
+        // Render thread, stops the workers and releases the staging buffer
+        void Shutdown();
+
+        inline uint32_t GetUploadBudget() const { return mUploadBudget; }
+        uint32_t GetPendingCount();
+
+    public:
+        static TextureLoader &Get();
+
+    private:
+        struct Request
+        {
+            std::string Name;
+            uint32_t Width = 0;
+            uint32_t Height = 0;
+            TextureFormat Format = TextureFormat::RGBA8;
+            bool Packed = false;
+            std::vector<uint8_t> Pixels;
+            std::vector<TextureLevel> Levels;
+            Ref<TextureRegion> Region;
+            std::vector<TextureLoadedCallback> Callbacks;
+        };
+
+    private:
+        void Start();
+        void Run();
+        void Decode(Request &request);
+        Ref<TextureRegion> UploadImage(Request &request);
+        Ref<TextureRegion> UploadLevels(Request &request);
+
+    private:
+        TextureAtlas &mAtlas;
+        uint32_t mWorkerCount;
+        uint32_t mUploadBudget;
+        std::vector<std::thread> mWorkers;
+        std::mutex mMutex;
+        std::condition_variable mWorkReady;
+        bool mRunning = false;
+
+        // Requests move from decode, to upload, to dispatch
+        std::unordered_map<std::string, Ref<Request>> mPending;
+        std::queue<Ref<Request>> mDecodeQueue;
+        std::queue<Ref<Request>> mUploadQueue;
+        std::vector<Ref<Request>> mCompleted;
+
+        // Images made resident, handed out again while still in use
+        std::unordered_map<std::string, std::weak_ptr<TextureRegion>> mResident;
+
+        Ref<StreamBuffer> mStaging;
+    };
+
+} // namespace Antomic
@@ -26,11 +26,21 @@ namespace Antomic {
         virtual ~VertexArray() = default;
 
     public:
+        // Bound by the draw commands using it
+        virtual void Record(CommandBuffer &commands) const override {}
+
         virtual void AddVertexBuffer(const Ref<VertexBuffer> &buffer) = 0;
         virtual void SetIndexBuffer(const Ref<IndexBuffer> &buffer) = 0;
         virtual const std::vector<Ref<VertexBuffer>> &GetVertexBuffers() const = 0;
         virtual const Ref<IndexBuffer> &GetIndexBuffer() const = 0;
 
+        // Attributes of the instance buffer advance once per instance. They
+        // start at InstanceAttributeBase whatever the vertex buffers hold,
+        // instanced shaders declare them from there.
+        static const uint32_t InstanceAttributeBase = 8;
+        virtual void SetInstanceBuffer(const Ref<VertexBuffer> &buffer) = 0;
+        virtual const Ref<VertexBuffer> &GetInstanceBuffer() const = 0;
+
     public:
         static Ref<VertexArray> Create();
     };
@@ -29,6 +29,7 @@
 #include "Renderer/VertexArray.h"
 #include "Renderer/Drawable.h"
 #include "Renderer/Texture.h"
+#include "Renderer/ResourceManager.h"
 #include "Renderer/Materials/BasicMaterial.h"
 #include "Graph/Node.h"
 #include "Graph/Scene.h"
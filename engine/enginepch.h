@@ -16,6 +16,7 @@
 #pragma once
 
 #include <cstdint>
+#include <limits>
 #include <iostream>
 #include <fstream>
 #include <memory>
@@ -46,4 +47,6 @@
 #include <iomanip>
 #include <thread>
 #include <mutex>
+#include <condition_variable>
+#include <atomic>
 
@@ -0,0 +1,83 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "gtest/gtest.h"
+#include "Core/Archive.h"
+
+using namespace Antomic;
+
+static std::vector<uint8_t> Bytes(const std::string &text)
+{
+    return std::vector<uint8_t>(text.begin(), text.end());
+}
+
+TEST(AntomicCoreTest, ArchiveTests)
+{
+    auto path = (std::filesystem::temp_directory_path() / "antomic_archive_test.pak").string();
+
+    // Paths are normalized before hashing, the same file is only added once
+    EXPECT_EQ(Archive::Hash("assets/shaders/../images/a.png"), Archive::Hash("assets/images/a.png"));
+    EXPECT_NE(Archive::Hash("assets/images/a.png"), Archive::Hash("assets/images/b.png"));
+
+    ArchiveWriter writer;
+    EXPECT_TRUE(writer.Add("assets/shaders/vs.glsl", Bytes("void main() {}")));
+    EXPECT_TRUE(writer.Add("assets/images/a.png", Bytes("abc")));
+    EXPECT_TRUE(writer.Add("assets/empty.txt", {}));
+    EXPECT_FALSE(writer.Add("assets/./images/a.png", Bytes("other")));
+    EXPECT_EQ(writer.GetEntryCount(), 3);
+    ASSERT_TRUE(writer.Write(path));
+
+    Archive archive;
+    ASSERT_TRUE(archive.Open(path));
+    EXPECT_EQ(archive.GetEntryCount(), 3);
+
+    // Blobs point into the mapping, aligned to 16 bytes
+    auto shader = archive.Find("assets/shaders/vs.glsl");
+    ASSERT_TRUE(shader.IsValid());
+    EXPECT_EQ(std::string((const char *)shader.Data, shader.Size), "void main() {}");
+    EXPECT_EQ((uintptr_t)shader.Data % Archive::Alignment, 0);
+
+    auto image = archive.Find("assets/images/a.png");
+    ASSERT_TRUE(image.IsValid());
+    EXPECT_EQ(std::string((const char *)image.Data, image.Size), "abc");
+    EXPECT_EQ((uintptr_t)image.Data % Archive::Alignment, 0);
+
+    EXPECT_TRUE(archive.Find("assets/empty.txt").IsValid());
+    EXPECT_EQ(archive.Find("assets/empty.txt").Size, 0);
+    EXPECT_FALSE(archive.Find("assets/missing.txt").IsValid());
+
+    archive.Close();
+    EXPECT_FALSE(archive.IsOpen());
+    EXPECT_FALSE(archive.Find("assets/images/a.png").IsValid());
+
+    // Mounted archives resolve paths before loose files
+    std::string contents;
+    EXPECT_FALSE(Archive::ReadFile("assets/images/a.png", contents));
+    ASSERT_TRUE(Archive::Mount(path));
+    EXPECT_TRUE(Archive::Resolve("assets/images/a.png").IsValid());
+    EXPECT_TRUE(Archive::ReadFile("assets/images/a.png", contents));
+    EXPECT_EQ(contents, "abc");
+    Archive::UnmountAll();
+    EXPECT_FALSE(Archive::Resolve("assets/images/a.png").IsValid());
+
+    // Truncated or foreign files are rejected
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+    EXPECT_FALSE(archive.Open(path));
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << "not an archive, just some text";
+    EXPECT_FALSE(archive.Open(path));
+    EXPECT_FALSE(Archive::Mount(path));
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,80 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "gtest/gtest.h"
+#include "Core/Base.h"
+#include "Events/Event.h"
+#include "Events/KeyEvent.h"
+#include "Events/WindowEvent.h"
+#include "Platform/Headless/Window.h"
+
+using namespace Antomic;
+
+static HeadlessEvent MakeEvent(uint64_t frame, HeadlessEventType type)
+{
+    HeadlessEvent event;
+    event.Frame = frame;
+    event.Type = type;
+    return event;
+}
+
+TEST(AntomicCoreTest, HeadlessWindowTests)
+{
+    auto press = MakeEvent(1, HeadlessEventType::KeyPressed);
+    press.KeyCode = Key::KeyW;
+    auto release = MakeEvent(3, HeadlessEventType::KeyReleased);
+    release.KeyCode = Key::KeyW;
+    auto move = MakeEvent(1, HeadlessEventType::MouseMoved);
+    move.X = 10.0f;
+    move.Y = 20.0f;
+    auto resize = MakeEvent(2, HeadlessEventType::Resize);
+    resize.X = 320.0f;
+    resize.Y = 200.0f;
+
+    // Given out of order, played by frame
+    HeadlessWindow window(640, 480, "headless", {release, MakeEvent(4, HeadlessEventType::Close), press, move, resize});
+
+    std::vector<EventType> received;
+    bool closed = false;
+    window.SetEventHandler([&](Event &event) {
+        received.push_back(event.GetEventType());
+        closed |= event.GetEventType() == EventType::WindowClose;
+    });
+
+    window.ProcessEvents();
+    EXPECT_TRUE(received.empty());
+    EXPECT_EQ(window.GetFrame(), 1);
+
+    window.ProcessEvents();
+    EXPECT_TRUE(window.IsKeyPressed(Key::KeyW));
+    EXPECT_EQ(window.GetMousePosition().x, 10.0f);
+    EXPECT_EQ(window.GetMousePosition().y, 20.0f);
+    ASSERT_EQ(received.size(), 2);
+    EXPECT_EQ(received[0], EventType::KeyPressed);
+    EXPECT_EQ(received[1], EventType::MouseMoved);
+
+    window.ProcessEvents();
+    EXPECT_EQ(window.GetWidth(), 320);
+    EXPECT_EQ(window.GetHeight(), 200);
+
+    window.ProcessEvents();
+    EXPECT_FALSE(window.IsKeyPressed(Key::KeyW));
+    EXPECT_FALSE(closed);
+
+    window.ProcessEvents();
+    EXPECT_TRUE(closed);
+    EXPECT_EQ(window.GetFrame(), 5);
+    EXPECT_EQ(received.size(), 5);
+}
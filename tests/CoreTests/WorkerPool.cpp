@@ -0,0 +1,55 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "gtest/gtest.h"
+#include "Core/Base.h"
+#include "Core/WorkerPool.h"
+
+using namespace Antomic;
+
+TEST(AntomicCoreTests, WorkerPoolTests)
+{
+    WorkerPool pool(3);
+    EXPECT_EQ(pool.GetWorkerCount(), 3);
+
+    // Every index runs once, whatever thread picks it
+    std::vector<std::atomic<uint32_t>> runs(64);
+    for (uint32_t call = 0; call < 100; call++)
+    {
+        pool.ParallelFor((uint32_t)runs.size(), [&runs](uint32_t index) { runs[index]++; });
+    }
+    for (auto &count : runs)
+    {
+        EXPECT_EQ(count, 100);
+    }
+
+    // Calls from several threads take turns
+    std::atomic<uint32_t> total = 0;
+    std::vector<std::thread> callers;
+    for (uint32_t caller = 0; caller < 4; caller++)
+    {
+        callers.emplace_back([&pool, &total]() {
+            for (uint32_t call = 0; call < 50; call++)
+            {
+                pool.ParallelFor(8, [&total](uint32_t) { total++; });
+            }
+        });
+    }
+    for (auto &caller : callers)
+    {
+        caller.join();
+    }
+    EXPECT_EQ(total, 4 * 50 * 8);
+}
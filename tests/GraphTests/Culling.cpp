@@ -0,0 +1,125 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "gtest/gtest.h"
+#include "Core/Base.h"
+#include "Graph/Scene.h"
+#include "Graph/3D/Node3d.h"
+#include "Renderer/Frustum.h"
+#include "Renderer/OcclusionBuffer.h"
+#include "Renderer/RendererFrame.h"
+#include "Renderer/Sprite.h"
+#include "glm/glm.hpp"
+#include <glm/gtc/matrix_transform.hpp>
+
+using namespace Antomic;
+
+class TestBoundedNode3d : public Node3d
+{
+public:
+    TestBoundedNode3d(const glm::vec3 &position) : mDrawable(CreateRef<Sprite>())
+    {
+        mLocal = glm::translate(glm::mat4(1.0f), position);
+        mDrawable->SetBounds(BoundingBox(glm::vec3(-1.0f), glm::vec3(1.0f)));
+    }
+
+protected:
+    virtual const Ref<Drawable> GetDrawable() const override { return mDrawable; };
+    virtual void UpdateSpatialInformation() override
+    {
+        auto parent = std::dynamic_pointer_cast<Node3d>(GetParent());
+        mWorld = (parent == nullptr) ? mLocal : parent->GetWorldMatrix() * mLocal;
+        mDrawable->SetModelMatrix(mWorld);
+        ClearDirty();
+    }
+
+private:
+    Ref<Sprite> mDrawable;
+};
+
+TEST(AntomicGraphTest, Node3dCullingTests)
+{
+    auto scene = CreateRef<Scene>();
+    scene->SetSubmitThreads(1);
+
+    // In front of a camera at the origin looking down -z
+    auto visible = CreateRef<TestBoundedNode3d>(glm::vec3(0.0f, 0.0f, -10.0f));
+    visible->AddChild(CreateRef<TestBoundedNode3d>(glm::vec3(1.0f, 0.0f, 0.0f)));
+    scene->AddChild(visible);
+
+    // Behind the camera, the whole subtree is skipped
+    auto hidden = CreateRef<TestBoundedNode3d>(glm::vec3(0.0f, 0.0f, 10.0f));
+    hidden->AddChild(CreateRef<TestBoundedNode3d>(glm::vec3(1.0f, 0.0f, 0.0f)));
+    hidden->AddChild(CreateRef<TestBoundedNode3d>(glm::vec3(-1.0f, 0.0f, 0.0f)));
+    scene->AddChild(hidden);
+
+    // The parent is visible but its child is far to the side
+    auto partial = CreateRef<TestBoundedNode3d>(glm::vec3(0.0f, 0.0f, -20.0f));
+    partial->AddChild(CreateRef<TestBoundedNode3d>(glm::vec3(500.0f, 0.0f, 0.0f)));
+    scene->AddChild(partial);
+
+    for (auto &child : scene->GetChildren())
+    {
+        child->Update(0);
+    }
+
+    auto bounds = hidden->GetWorldBounds();
+    EXPECT_EQ(bounds.Min, glm::vec3(-2.0f, -1.0f, 9.0f));
+    EXPECT_EQ(bounds.Max, glm::vec3(2.0f, 1.0f, 11.0f));
+
+    auto frame = CreateRef<RendererFrame>(RendererViewport(800, 600), glm::mat4(1.0f));
+    auto projection = glm::perspective(glm::radians(45.0f), 800.0f / 600.0f, 0.1f, 100.0f);
+    frame->SetFrustum(Frustum(projection));
+
+    scene->SubmitDrawables(frame);
+    EXPECT_EQ(frame->GetVisibleCount(), 3);
+    EXPECT_EQ(frame->GetCulledCount(), 4);
+}
+
+TEST(AntomicGraphTest, Node3dOcclusionTests)
+{
+    auto scene = CreateRef<Scene>();
+    scene->SetSubmitThreads(1);
+
+    // A wall facing the camera, its occluder fits inside its bounds
+    auto occluder = CreateRef<Occluder>();
+    occluder->Positions = {{-1.0f, -1.0f, 0.0f}, {1.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 0.0f}, {-1.0f, 1.0f, 0.0f}};
+    occluder->Indices = {0, 1, 2, 2, 3, 0};
+
+    auto wall = CreateRef<TestBoundedNode3d>(glm::vec3(0.0f, 0.0f, -5.0f));
+    wall->SetOccluder(occluder);
+    scene->AddChild(wall);
+
+    // Straight behind the wall, and behind it but off to the side
+    auto behind = CreateRef<TestBoundedNode3d>(glm::vec3(0.0f, 0.0f, -30.0f));
+    scene->AddChild(behind);
+    auto side = CreateRef<TestBoundedNode3d>(glm::vec3(10.0f, 0.0f, -30.0f));
+    scene->AddChild(side);
+
+    for (auto &child : scene->GetChildren())
+    {
+        child->Update(0);
+    }
+
+    auto frame = CreateRef<RendererFrame>(RendererViewport(800, 600), glm::mat4(1.0f));
+    auto projection = glm::perspective(glm::radians(45.0f), 800.0f / 600.0f, 0.1f, 100.0f);
+    frame->SetProjection(projection, glm::mat4(1.0f));
+    frame->SetFrustum(Frustum(projection));
+
+    scene->SubmitDrawables(frame);
+    EXPECT_EQ(scene->GetOcclusionBuffer()->GetOccluderCount(), 1);
+    EXPECT_EQ(frame->GetVisibleCount(), 2);
+    EXPECT_EQ(frame->GetCulledCount(), 1);
+}
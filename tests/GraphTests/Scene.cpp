@@ -0,0 +1,84 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "gtest/gtest.h"
+#include "Core/Base.h"
+#include "Graph/Scene.h"
+#include "Renderer/RendererFrame.h"
+#include "Renderer/Sprite.h"
+#include "glm/glm.hpp"
+
+using namespace Antomic;
+
+class TestSpriteNode : public Node
+{
+public:
+    TestSpriteNode(float marker) : mSprite(CreateRef<Sprite>())
+    {
+        mSprite->SetSpriteColor(glm::vec4(marker));
+    }
+
+public:
+    virtual NodeType GetType() override { return NodeType::NODE_2D; }
+
+protected:
+    virtual const Ref<Drawable> GetDrawable() const override { return mSprite; };
+    virtual void UpdateSpatialInformation() override {}
+
+private:
+    Ref<Sprite> mSprite;
+};
+
+static std::vector<float> SubmitMarkers(const Ref<Scene> &scene, uint32_t threads)
+{
+    auto frame = CreateRef<RendererFrame>(RendererViewport(800, 600), glm::mat4(1.0f));
+    scene->SetSubmitThreads(threads);
+    scene->SubmitDrawables(frame);
+
+    std::vector<float> markers;
+    for (auto &sprite : frame->GetSprites())
+    {
+        markers.push_back(sprite.GetSpriteColor().r);
+    }
+    return markers;
+}
+
+TEST(AntomicGraphTest, SceneSubmitTests)
+{
+    auto scene = CreateRef<Scene>();
+
+    float marker = 0.0f;
+    for (int i = 0; i < 100; i++)
+    {
+        auto node = CreateRef<TestSpriteNode>(marker++);
+        scene->AddChild(node);
+        for (int j = 0; j < 3; j++)
+        {
+            node->AddChild(CreateRef<TestSpriteNode>(marker++));
+        }
+    }
+
+    // Every thread count submits the same drawables in the same order
+    auto serial = SubmitMarkers(scene, 1);
+    ASSERT_EQ(serial.size(), 400);
+    for (size_t i = 0; i < serial.size(); i++)
+    {
+        EXPECT_EQ(serial[i], (float)i);
+    }
+
+    EXPECT_EQ(SubmitMarkers(scene, 2), serial);
+    EXPECT_EQ(SubmitMarkers(scene, 4), serial);
+    EXPECT_EQ(SubmitMarkers(scene, 0), serial);
+}
@@ -0,0 +1,199 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "gtest/gtest.h"
+#include "Core/Base.h"
+#include "Graph/Scene.h"
+#include "Graph/2D/Node2d.h"
+#include "Graph/2D/AABBTree.h"
+#include "Renderer/RendererFrame.h"
+#include "Renderer/Sprite.h"
+#include "glm/glm.hpp"
+
+using namespace Antomic;
+
+class TestIndexedNode2d : public Node2d
+{
+public:
+    TestIndexedNode2d(float marker) : mSprite(CreateRef<Sprite>())
+    {
+        mSprite->SetSpriteColor(glm::vec4(marker));
+    }
+
+protected:
+    virtual const Ref<Drawable> GetDrawable() const override { return mSprite; };
+
+private:
+    Ref<Sprite> mSprite;
+};
+
+// Not a Node2d, walked by the scene instead of indexed
+class TestGroupNode : public Node
+{
+public:
+    TestGroupNode(float marker = -1.0f) : mSprite(marker >= 0.0f ? CreateRef<Sprite>() : nullptr)
+    {
+        if (mSprite != nullptr)
+        {
+            mSprite->SetSpriteColor(glm::vec4(marker));
+        }
+    }
+
+public:
+    virtual NodeType GetType() override { return NodeType::NODE_2D; }
+
+protected:
+    virtual const Ref<Drawable> GetDrawable() const override { return mSprite; }
+    virtual void UpdateSpatialInformation() override {}
+
+private:
+    Ref<Sprite> mSprite;
+};
+
+static std::vector<int32_t> QueryProxies(const AABBTree &tree, const Rect &rect)
+{
+    std::vector<int32_t> proxies;
+    tree.Query(rect, [&proxies](int32_t proxy, void *) { proxies.push_back(proxy); });
+    std::sort(proxies.begin(), proxies.end());
+    return proxies;
+}
+
+TEST(AntomicGraphTest, AABBTreeQueryTests)
+{
+    AABBTree tree(1.0f);
+
+    // A 32x32 grid of unit cells, 2 units apart
+    std::vector<int32_t> proxies;
+    for (int y = 0; y < 32; y++)
+    {
+        for (int x = 0; x < 32; x++)
+        {
+            auto min = glm::vec2(x * 2.0f, y * 2.0f);
+            proxies.push_back(tree.Insert(Rect(min, min + glm::vec2(1.0f)), nullptr));
+        }
+    }
+    EXPECT_EQ(tree.GetProxyCount(), 1024);
+
+    // Balanced, a degenerate tree would be as tall as the proxy count
+    EXPECT_LE(tree.GetHeight(), 20);
+
+    // Queries use the tight rects, the fat margin never reports extra cells
+    EXPECT_EQ(QueryProxies(tree, Rect(glm::vec2(0.5f), glm::vec2(0.5f))), std::vector<int32_t>{proxies[0]});
+    EXPECT_TRUE(QueryProxies(tree, Rect(glm::vec2(1.5f), glm::vec2(1.5f))).empty());
+    EXPECT_EQ(QueryProxies(tree, Rect(glm::vec2(0.0f), glm::vec2(3.0f))).size(), 4);
+
+    // Small moves stay inside the fat rect, large ones re-insert
+    EXPECT_FALSE(tree.Move(proxies[0], Rect(glm::vec2(0.5f), glm::vec2(1.5f))));
+    EXPECT_TRUE(tree.Move(proxies[0], Rect(glm::vec2(100.0f), glm::vec2(101.0f))));
+    EXPECT_EQ(QueryProxies(tree, Rect(glm::vec2(100.5f), glm::vec2(100.5f))), std::vector<int32_t>{proxies[0]});
+    EXPECT_TRUE(QueryProxies(tree, Rect(glm::vec2(0.5f), glm::vec2(0.5f))).empty());
+
+    // Removed proxies are never reported
+    for (int i = 0; i < 512; i++)
+    {
+        tree.Remove(proxies[i]);
+    }
+    EXPECT_EQ(tree.GetProxyCount(), 512);
+    EXPECT_EQ(QueryProxies(tree, Rect(glm::vec2(-10.0f), glm::vec2(200.0f))).size(), 512);
+}
+
+TEST(AntomicGraphTest, SceneIndex2dTests)
+{
+    auto scene = CreateRef<Scene>();
+
+    // A row of 20x20 sprites centered 100 units apart, the view is 800 wide
+    VectorRef<Node2d> nodes;
+    for (int i = 0; i < 20; i++)
+    {
+        auto node = CreateRef<TestIndexedNode2d>((float)i);
+        node->SetSize(glm::vec2(20.0f));
+        node->SetPosition(glm::vec2(i * 100.0f, 10.0f));
+        scene->AddChild(node);
+        nodes.push_back(node);
+    }
+    scene->Node::Update(0);
+    EXPECT_EQ(scene->GetSpatialIndex2d()->GetProxyCount(), 20);
+
+    auto frame = CreateRef<RendererFrame>(RendererViewport(800, 600), glm::mat4(1.0f));
+    scene->SubmitDrawables(frame);
+
+    // Only the sprites in view are submitted, in scene order
+    ASSERT_EQ(frame->GetSprites().size(), 9);
+    for (size_t i = 0; i < frame->GetSprites().size(); i++)
+    {
+        EXPECT_EQ(frame->GetSprites()[i].GetSpriteColor().r, (float)i);
+    }
+    EXPECT_EQ(frame->GetCulledCount(), 11);
+
+    // Picking
+    auto picked = scene->QueryNodes2d(glm::vec2(305.0f, 15.0f));
+    ASSERT_EQ(picked.size(), 1);
+    EXPECT_EQ(picked[0], nodes[3]);
+    EXPECT_TRUE(scene->QueryNodes2d(glm::vec2(350.0f, 15.0f)).empty());
+
+    // Moved and removed nodes follow the graph
+    nodes[3]->SetPosition(glm::vec2(2000.0f, 10.0f));
+    scene->RemoveChild(nodes[4]);
+    scene->Node::Update(0);
+    EXPECT_TRUE(scene->QueryNodes2d(glm::vec2(305.0f, 15.0f)).empty());
+    EXPECT_EQ(scene->QueryNodes2d(glm::vec2(2005.0f, 15.0f)).size(), 1);
+    EXPECT_EQ(scene->GetSpatialIndex2d()->GetProxyCount(), 19);
+
+    // Nodes added later are submitted at their place in the graph
+    auto child = CreateRef<TestIndexedNode2d>(100.0f);
+    nodes[0]->AddChild(child);
+    scene->Node::Update(0);
+    frame = CreateRef<RendererFrame>(RendererViewport(800, 600), glm::mat4(1.0f));
+    scene->SubmitDrawables(frame);
+    ASSERT_GE(frame->GetSprites().size(), 3);
+    EXPECT_EQ(frame->GetSprites()[0].GetSpriteColor().r, 0.0f);
+    EXPECT_EQ(frame->GetSprites()[1].GetSpriteColor().r, 100.0f);
+    EXPECT_EQ(frame->GetSprites()[2].GetSpriteColor().r, 1.0f);
+}
+
+TEST(AntomicGraphTest, SceneIndex2dNestingTests)
+{
+    auto scene = CreateRef<Scene>();
+
+    // A 2D node under a node the scene walks
+    auto group = CreateRef<TestGroupNode>();
+    auto nested = CreateRef<TestIndexedNode2d>(1.0f);
+    nested->SetSize(glm::vec2(20.0f));
+    nested->SetPosition(glm::vec2(100.0f, 10.0f));
+    group->AddChild(nested);
+    scene->AddChild(group);
+
+    // A walked drawable under an indexed 2D node
+    auto indexed = CreateRef<TestIndexedNode2d>(2.0f);
+    indexed->SetSize(glm::vec2(20.0f));
+    indexed->SetPosition(glm::vec2(200.0f, 10.0f));
+    indexed->AddChild(CreateRef<TestGroupNode>(3.0f));
+    scene->AddChild(indexed);
+
+    scene->Node::Update(0);
+    EXPECT_EQ(scene->GetSpatialIndex2d()->GetProxyCount(), 2);
+
+    auto frame = CreateRef<RendererFrame>(RendererViewport(800, 600), glm::mat4(1.0f));
+    scene->SubmitDrawables(frame);
+
+    // Every drawable is submitted once
+    std::vector<float> markers;
+    for (auto &sprite : frame->GetSprites())
+    {
+        markers.push_back(sprite.GetSpriteColor().r);
+    }
+    std::sort(markers.begin(), markers.end());
+    EXPECT_EQ(markers, std::vector<float>({1.0f, 2.0f, 3.0f}));
+}
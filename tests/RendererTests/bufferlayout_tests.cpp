@@ -50,3 +50,37 @@ TEST(AntomicRendererTests, BufferLayoutTests)
 
     EXPECT_EQ(uBLayout1.Stride(), 192);
 }
+
+TEST(AntomicRendererTests, CompactBufferLayoutTests)
+{
+    BufferLayout layout = {
+        {ShaderDataType::Half4, "aPos"},
+        {ShaderDataType::Int1010102, "aNormal", true},
+        {ShaderDataType::UByte4, "aColor", true},
+        {ShaderDataType::Short2, "aTexCoord", true}};
+
+    // Same attributes as vec3, vec3, vec4, vec2 in 20 bytes instead of 48
+    EXPECT_EQ(layout.Stride(), 20);
+    EXPECT_EQ(layout.Elements()[1].Offset, 8);
+    EXPECT_EQ(layout.Elements()[3].Offset, 16);
+    EXPECT_TRUE(layout.Elements()[2].Normalized);
+}
+
+TEST(AntomicRendererTests, IndexBufferTypeTests)
+{
+    // Indices are stored in 16 bits while every one of them fits
+    std::vector<uint32_t> small = {0, 1, 2, 2, 3, 0xFFFF};
+    auto buffer = IndexBuffer::Create(small.data(), (uint32_t)(small.size() * sizeof(uint32_t)));
+    EXPECT_EQ(buffer->Type(), IndexType::UInt16);
+    EXPECT_EQ(buffer->Count(), 6);
+
+    std::vector<uint32_t> large = {0, 1, 0x10000};
+    buffer = IndexBuffer::Create(large.data(), (uint32_t)(large.size() * sizeof(uint32_t)));
+    EXPECT_EQ(buffer->Type(), IndexType::UInt32);
+    EXPECT_EQ(buffer->Count(), 3);
+
+    uint16_t indices[3] = {0, 1, 2};
+    buffer = IndexBuffer::Create(indices, sizeof(indices));
+    EXPECT_EQ(buffer->Type(), IndexType::UInt16);
+    EXPECT_EQ(buffer->Count(), 3);
+}
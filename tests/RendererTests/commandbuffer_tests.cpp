@@ -0,0 +1,70 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "gtest/gtest.h"
+#include "Renderer/Buffers.h"
+#include "Renderer/CommandBuffer.h"
+#include "Renderer/Shader.h"
+#include "Renderer/VertexArray.h"
+#include "glm/glm.hpp"
+
+using namespace Antomic;
+
+TEST(AntomicRendererTests, CommandBufferTests)
+{
+    auto shader = Shader::CreateFromSource("", "");
+    auto vertexArray = VertexArray::Create();
+    uint32_t indices[6] = {0, 1, 2, 2, 3, 0};
+    vertexArray->SetIndexBuffer(IndexBuffer::Create(indices, sizeof(indices)));
+
+    CommandBuffer commands;
+    commands.SetClearColor(glm::vec4(1.0f, 0.0f, 0.0f, 1.0f));
+    commands.BindShader(shader.get());
+    commands.SetUniform(shader, UniformHandle<glm::vec4>(3), glm::vec4(0.5f));
+    commands.SetUniform(shader, UniformHandle<glm::vec4>(), glm::vec4(0.5f));
+    commands.DrawIndexed(vertexArray);
+    EXPECT_EQ(commands.GetCommandCount(), 4);
+
+    // Packets come back in recording order
+    auto header = commands.Begin();
+    ASSERT_EQ(header->Type, RenderCommandType::SET_CLEAR_COLOR);
+    EXPECT_EQ(CommandBuffer::GetCommand<RenderCommands::SetClearColor>(header).Color, glm::vec4(1.0f, 0.0f, 0.0f, 1.0f));
+
+    header = CommandBuffer::Next(header);
+    ASSERT_EQ(header->Type, RenderCommandType::BIND_SHADER);
+    EXPECT_EQ(CommandBuffer::GetCommand<RenderCommands::BindShader>(header).Program, shader.get());
+
+    // Invalid handles are not recorded, values follow the packet
+    header = CommandBuffer::Next(header);
+    ASSERT_EQ(header->Type, RenderCommandType::SET_UNIFORM);
+    auto &uniform = CommandBuffer::GetCommand<RenderCommands::SetUniform>(header);
+    EXPECT_EQ(uniform.Location, 3);
+    EXPECT_EQ(uniform.DataType, ShaderDataType::Vec4);
+    EXPECT_EQ(*static_cast<const glm::vec4 *>(CommandBuffer::GetPayload(&uniform)), glm::vec4(0.5f));
+
+    // The index type and count are taken from the index buffer
+    header = CommandBuffer::Next(header);
+    ASSERT_EQ(header->Type, RenderCommandType::DRAW_INDEXED);
+    auto &draw = CommandBuffer::GetCommand<RenderCommands::DrawIndexed>(header);
+    EXPECT_EQ(draw.Vertices, vertexArray.get());
+    EXPECT_EQ(draw.Indices, IndexType::UInt16);
+    EXPECT_EQ(draw.IndexCount, 6);
+
+    EXPECT_EQ(CommandBuffer::Next(header), commands.End());
+
+    commands.Reset();
+    EXPECT_TRUE(commands.Empty());
+    EXPECT_EQ(commands.Begin(), commands.End());
+}
@@ -0,0 +1,52 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "gtest/gtest.h"
+#include "Renderer/Bounds.h"
+#include "Renderer/Frustum.h"
+#include "glm/glm.hpp"
+#include <glm/gtc/matrix_transform.hpp>
+
+using namespace Antomic;
+
+TEST(AntomicRendererTests, FrustumTests)
+{
+    auto projection = glm::perspective(glm::radians(90.0f), 1.0f, 1.0f, 100.0f);
+    auto view = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    Frustum frustum(projection * view);
+
+    BoundingBox unit(glm::vec3(-1.0f), glm::vec3(1.0f));
+    auto translate = [&unit](const glm::vec3 &position) {
+        return unit.Transform(glm::translate(glm::mat4(1.0f), position));
+    };
+
+    EXPECT_EQ(frustum.Test(translate({0.0f, 0.0f, -10.0f})), FrustumTest::INSIDE);
+    EXPECT_EQ(frustum.Test(translate({0.0f, 0.0f, 10.0f})), FrustumTest::OUTSIDE);
+    EXPECT_EQ(frustum.Test(translate({50.0f, 0.0f, -10.0f})), FrustumTest::OUTSIDE);
+    EXPECT_EQ(frustum.Test(translate({10.0f, 0.0f, -10.0f})), FrustumTest::INTERSECT);
+    EXPECT_EQ(frustum.Test(translate({0.0f, 0.0f, -100.0f})), FrustumTest::INTERSECT);
+
+    // Unknown bounds are never culled, empty ones always are
+    EXPECT_EQ(frustum.Test(BoundingBox::Infinite()), FrustumTest::INTERSECT);
+    EXPECT_EQ(frustum.Test(BoundingBox()), FrustumTest::OUTSIDE);
+
+    // The default frustum contains everything
+    EXPECT_EQ(Frustum().Test(translate({0.0f, 0.0f, 10.0f})), FrustumTest::INSIDE);
+
+    // Rotated boxes grow to contain the rotated corners
+    auto rotated = unit.Transform(glm::rotate(glm::mat4(1.0f), glm::radians(45.0f), glm::vec3(0.0f, 0.0f, 1.0f)));
+    EXPECT_NEAR(rotated.Max.x, std::sqrt(2.0f), 1e-5f);
+    EXPECT_NEAR(rotated.Max.z, 1.0f, 1e-5f);
+}
@@ -0,0 +1,78 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#ifdef ANTOMIC_GL_RENDERER
+#include "gtest/gtest.h"
+#include "Platform/OpenGL/State.h"
+
+using namespace Antomic;
+
+// No context here, the loader entry points are replaced by counters
+static uint32_t sUseProgramCalls = 0;
+static uint32_t sBindBufferCalls = 0;
+static uint32_t sBindBufferBaseCalls = 0;
+
+static void APIENTRY CountUseProgram(GLuint program) { sUseProgramCalls++; }
+static void APIENTRY CountBindBuffer(GLenum target, GLuint buffer) { sBindBufferCalls++; }
+static void APIENTRY CountBindBufferBase(GLenum target, GLuint index, GLuint buffer) { sBindBufferBaseCalls++; }
+
+TEST(AntomicRendererTests, OpenGLStateTests)
+{
+    auto useProgram = glad_glUseProgram;
+    auto bindBuffer = glad_glBindBuffer;
+    auto bindBufferBase = glad_glBindBufferBase;
+    glad_glUseProgram = CountUseProgram;
+    glad_glBindBuffer = CountBindBuffer;
+    glad_glBindBufferBase = CountBindBufferBase;
+
+    OpenGLState::Invalidate();
+    OpenGLState::ResetStats();
+
+    // Binding what is already bound never reaches the driver
+    OpenGLState::UseProgram(1);
+    OpenGLState::UseProgram(1);
+    OpenGLState::UseProgram(2);
+    EXPECT_EQ(sUseProgramCalls, 2);
+    EXPECT_EQ(OpenGLState::GetStats().Issued, 2);
+    EXPECT_EQ(OpenGLState::GetStats().Skipped, 1);
+
+    // Binding points are shadowed one by one
+    OpenGLState::BindBufferBase(GL_UNIFORM_BUFFER, 0, 3);
+    OpenGLState::BindBufferBase(GL_UNIFORM_BUFFER, 0, 3);
+    OpenGLState::BindBufferBase(GL_UNIFORM_BUFFER, 1, 3);
+    EXPECT_EQ(sBindBufferBaseCalls, 2);
+
+    // And leave the buffer bound to the generic target
+    OpenGLState::BindBuffer(GL_UNIFORM_BUFFER, 3);
+    EXPECT_EQ(sBindBufferCalls, 0);
+
+    // Deleted names may come back, their bindings are forgotten
+    OpenGLState::ReleaseBuffer(3);
+    OpenGLState::BindBufferBase(GL_UNIFORM_BUFFER, 0, 3);
+    OpenGLState::BindBuffer(GL_UNIFORM_BUFFER, 3);
+    EXPECT_EQ(sBindBufferBaseCalls, 3);
+    EXPECT_EQ(sBindBufferCalls, 0);
+
+    OpenGLState::ReleaseProgram(2);
+    OpenGLState::UseProgram(2);
+    EXPECT_EQ(sUseProgramCalls, 3);
+
+    OpenGLState::Invalidate();
+    OpenGLState::ResetStats();
+    glad_glUseProgram = useProgram;
+    glad_glBindBuffer = bindBuffer;
+    glad_glBindBufferBase = bindBufferBase;
+}
+#endif
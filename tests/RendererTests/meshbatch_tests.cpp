@@ -0,0 +1,86 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "gtest/gtest.h"
+#include "Renderer/Material.h"
+#include "Renderer/Mesh.h"
+#include "Renderer/RendererFrame.h"
+#include "Renderer/Shader.h"
+#include "Renderer/VertexArray.h"
+#include "glm/glm.hpp"
+
+using namespace Antomic;
+
+class TestMaterial : public Material
+{
+public:
+    TestMaterial() { mShader = Shader::CreateFromSource("", ""); }
+
+public:
+    virtual void Bind() const override {}
+    virtual void Unbind() const override {}
+    virtual const Ref<Shader> &GetShader() const override { return mShader; }
+    virtual const Ref<Shader> &GetInstancedShader() const override { return mShader; }
+
+private:
+    Ref<Shader> mShader;
+};
+
+TEST(AntomicRendererTests, MeshBatchTests)
+{
+    auto geometry = VertexArray::Create();
+    auto other = VertexArray::Create();
+    Ref<Material> material = CreateRef<TestMaterial>();
+
+    RendererFrame frame(RendererViewport(800, 600), glm::mat4(1.0f));
+
+    // Meshes sharing geometry and material end up on the same batch
+    for (int i = 0; i < 3; i++)
+    {
+        frame.QueueDrawable(CreateRef<Mesh>(geometry, material));
+    }
+    frame.QueueDrawable(CreateRef<Mesh>(other, material));
+
+    // Different bindables can't be drawn with the same call
+    auto bound = CreateRef<Mesh>(geometry, material);
+    bound->AddBindable(material);
+    frame.QueueDrawable(bound);
+
+    auto &batches = frame.GetMeshBatches();
+    ASSERT_EQ(batches.size(), 3);
+    EXPECT_EQ(batches[0].Meshes.size(), 3);
+    EXPECT_EQ(batches[1].Meshes.size(), 1);
+    EXPECT_EQ(batches[1].Meshes.front()->GetVertexArray(), other);
+    EXPECT_EQ(batches[2].Meshes.front(), bound);
+}
+
+TEST(AntomicRendererTests, MeshBatchSnapshotTests)
+{
+    auto geometry = VertexArray::Create();
+    Ref<Material> material = CreateRef<TestMaterial>();
+    auto mesh = CreateRef<Mesh>(geometry, material);
+    mesh->SetModelMatrix(glm::mat4(1.0f));
+
+    RendererFrame frame(RendererViewport(800, 600), glm::mat4(1.0f));
+    frame.QueueDrawable(mesh);
+
+    // Updating the scene for the next frame leaves the queued one intact
+    mesh->SetModelMatrix(glm::mat4(2.0f));
+
+    auto &batches = frame.GetMeshBatches();
+    ASSERT_EQ(batches.size(), 1);
+    ASSERT_EQ(batches[0].Models.size(), 1);
+    EXPECT_EQ(batches[0].Models[0], glm::mat4(1.0f));
+}
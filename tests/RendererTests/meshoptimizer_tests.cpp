@@ -0,0 +1,113 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "gtest/gtest.h"
+#include "Core/Base.h"
+#include "Renderer/MeshOptimizer.h"
+#include "glm/glm.hpp"
+#include <random>
+
+using namespace Antomic;
+
+// Grid of quads in the XY plane, triangles and vertices shuffled
+static void CreateGrid(uint32_t size, std::vector<uint32_t> &indices, std::vector<glm::vec3> &positions)
+{
+    std::mt19937 random(7);
+    std::vector<uint32_t> order((size + 1) * (size + 1));
+    for (uint32_t i = 0; i < order.size(); i++)
+    {
+        order[i] = i;
+    }
+    std::shuffle(order.begin(), order.end(), random);
+
+    positions.resize(order.size());
+    for (uint32_t y = 0; y <= size; y++)
+    {
+        for (uint32_t x = 0; x <= size; x++)
+        {
+            positions[order[y * (size + 1) + x]] = glm::vec3(x, y, 0.0f);
+        }
+    }
+
+    std::vector<glm::uvec3> triangles;
+    for (uint32_t y = 0; y < size; y++)
+    {
+        for (uint32_t x = 0; x < size; x++)
+        {
+            auto a = order[y * (size + 1) + x], b = order[y * (size + 1) + x + 1];
+            auto c = order[(y + 1) * (size + 1) + x], d = order[(y + 1) * (size + 1) + x + 1];
+            triangles.push_back({a, b, d});
+            triangles.push_back({a, d, c});
+        }
+    }
+    std::shuffle(triangles.begin(), triangles.end(), random);
+
+    indices.clear();
+    for (auto &triangle : triangles)
+    {
+        indices.insert(indices.end(), {triangle.x, triangle.y, triangle.z});
+    }
+}
+
+TEST(AntomicRendererTests, MeshOptimizerTests)
+{
+    // A single triangle transforms each vertex once
+    auto stats = MeshOptimizer::AnalyzeVertexCache({0, 1, 2}, 3);
+    EXPECT_EQ(stats.Transformed, 3);
+    EXPECT_FLOAT_EQ(stats.ACMR, 3.0f);
+    EXPECT_FLOAT_EQ(stats.ATVR, 1.0f);
+
+    std::vector<uint32_t> indices;
+    std::vector<glm::vec3> positions;
+    CreateGrid(32, indices, positions);
+    auto vertexCount = (uint32_t)positions.size();
+
+    // Reordering keeps every triangle, only the order changes
+    auto before = MeshOptimizer::AnalyzeVertexCache(indices, vertexCount);
+    auto optimized = MeshOptimizer::OptimizeVertexCache(indices, vertexCount);
+    ASSERT_EQ(optimized.size(), indices.size());
+    auto after = MeshOptimizer::AnalyzeVertexCache(optimized, vertexCount);
+    EXPECT_GT(before.ACMR, 2.0f);
+    EXPECT_LT(after.ACMR, 0.8f);
+    EXPECT_LT(after.ATVR, before.ATVR);
+
+    // Vertices end up in the order they are first used
+    std::vector<uint8_t> vertices(vertexCount * sizeof(glm::vec3));
+    std::memcpy(vertices.data(), positions.data(), vertices.size());
+    EXPECT_EQ(MeshOptimizer::OptimizeVertexFetch(optimized, vertices, sizeof(glm::vec3)), vertexCount);
+    uint32_t next = 0;
+    for (auto index : optimized)
+    {
+        EXPECT_LE(index, next);
+        next = std::max(next, index + 1);
+    }
+
+    // Unreferenced vertices are dropped
+    std::vector<uint32_t> sparse = {4, 2, 0};
+    std::vector<uint8_t> data = {0, 1, 2, 3, 4};
+    EXPECT_EQ(MeshOptimizer::OptimizeVertexFetch(sparse, data, 1), 3);
+    EXPECT_EQ(sparse, std::vector<uint32_t>({0, 1, 2}));
+    EXPECT_EQ(data, std::vector<uint8_t>({4, 2, 0}));
+
+    // The whole pipeline reports both sides
+    vertices.resize(vertexCount * sizeof(glm::vec3));
+    std::memcpy(vertices.data(), positions.data(), vertices.size());
+    auto report = MeshOptimizer::Optimize(indices, vertices, sizeof(glm::vec3));
+    EXPECT_FLOAT_EQ(report.Before.ACMR, before.ACMR);
+    EXPECT_LT(report.After.ACMR, 0.8f);
+    EXPECT_EQ(report.VerticesBefore, vertexCount);
+    EXPECT_EQ(report.VerticesAfter, vertexCount);
+    EXPECT_EQ(indices.size(), optimized.size());
+}
@@ -0,0 +1,70 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "gtest/gtest.h"
+#include "Core/Base.h"
+#include "Renderer/OcclusionBuffer.h"
+#include "glm/glm.hpp"
+#include <glm/gtc/matrix_transform.hpp>
+
+using namespace Antomic;
+
+static Ref<Occluder> CreateQuadOccluder(float size)
+{
+    auto occluder = CreateRef<Occluder>();
+    occluder->Positions = {{-size, -size, 0.0f}, {size, -size, 0.0f}, {size, size, 0.0f}, {-size, size, 0.0f}};
+    occluder->Indices = {0, 1, 2, 2, 3, 0};
+    return occluder;
+}
+
+TEST(AntomicRendererTests, OcclusionBufferTests)
+{
+    auto projection = glm::perspective(glm::radians(60.0f), 2.0f, 0.1f, 100.0f);
+    OcclusionBuffer buffer(256, 128);
+
+    // Nothing is hidden without occluders
+    buffer.Begin(projection);
+    buffer.Rasterize();
+    EXPECT_FALSE(buffer.IsOccluded(BoundingBox(glm::vec3(-0.5f, -0.5f, -20.5f), glm::vec3(0.5f, 0.5f, -19.5f))));
+
+    // A quad facing the camera covers the center of the buffer
+    buffer.Begin(projection);
+    buffer.AddOccluder(CreateQuadOccluder(1.0f), glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, -5.0f)));
+    buffer.Rasterize(4);
+    EXPECT_LT(buffer.GetDepth(128, 64), 1.0f);
+    EXPECT_EQ(buffer.GetDepth(0, 0), 1.0f);
+    EXPECT_EQ(buffer.GetDepth(255, 127), 1.0f);
+
+    // Behind the quad, in front of it, and behind it but to the side
+    EXPECT_TRUE(buffer.IsOccluded(BoundingBox(glm::vec3(-0.5f, -0.5f, -20.5f), glm::vec3(0.5f, 0.5f, -19.5f))));
+    EXPECT_FALSE(buffer.IsOccluded(BoundingBox(glm::vec3(-0.5f, -0.5f, -3.5f), glm::vec3(0.5f, 0.5f, -2.5f))));
+    EXPECT_FALSE(buffer.IsOccluded(BoundingBox(glm::vec3(9.5f, -0.5f, -20.5f), glm::vec3(10.5f, 0.5f, -19.5f))));
+
+    // Boxes reaching behind the camera are never hidden
+    EXPECT_FALSE(buffer.IsOccluded(BoundingBox(glm::vec3(-0.5f, -0.5f, -20.0f), glm::vec3(0.5f, 0.5f, 1.0f))));
+
+    // Serial and threaded rasterization give the same depths
+    OcclusionBuffer serial(256, 128);
+    serial.Begin(projection);
+    serial.AddOccluder(CreateQuadOccluder(1.0f), glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, -5.0f)));
+    serial.Rasterize(1);
+    for (uint32_t y = 0; y < 128; y++)
+    {
+        for (uint32_t x = 0; x < 256; x++)
+        {
+            ASSERT_EQ(serial.GetDepth(x, y), buffer.GetDepth(x, y));
+        }
+    }
+}
@@ -0,0 +1,107 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "gtest/gtest.h"
+#include "Renderer/Buffers.h"
+#include "Renderer/CommandBuffer.h"
+#include "Renderer/Material.h"
+#include "Renderer/Mesh.h"
+#include "Renderer/RendererFrame.h"
+#include "Renderer/RendererStats.h"
+#include "Renderer/Shader.h"
+#include "Renderer/Texture.h"
+#include "Renderer/VertexArray.h"
+#include "glm/glm.hpp"
+
+using namespace Antomic;
+
+class StatsMaterial : public Material
+{
+public:
+    StatsMaterial() { mShader = Shader::CreateFromSource("", ""); }
+
+public:
+    virtual void Bind() const override {}
+    virtual void Unbind() const override {}
+    virtual const Ref<Shader> &GetShader() const override { return mShader; }
+
+private:
+    Ref<Shader> mShader;
+};
+
+TEST(AntomicRendererTests, RendererStatsTests)
+{
+    auto shader = Shader::CreateFromSource("", "");
+    auto other = Shader::CreateFromSource("", "");
+    auto texture = Texture::CreateTexture(TextureSpecification());
+    auto quad = VertexArray::Create();
+    uint32_t indices[6] = {0, 1, 2, 2, 3, 0};
+    quad->SetIndexBuffer(IndexBuffer::Create(indices, sizeof(indices)));
+    auto cube = VertexArray::Create();
+    std::vector<uint32_t> cubeIndices(36, 0);
+    cube->SetIndexBuffer(IndexBuffer::Create(cubeIndices.data(), (uint32_t)(cubeIndices.size() * sizeof(uint32_t))));
+
+    CommandBuffer commands;
+    commands.Clear();
+    commands.BindShader(shader.get());
+    commands.BindTexture(texture.get(), 0);
+    commands.SetUniform(shader, UniformHandle<glm::mat4>(0), glm::mat4(1.0f));
+    commands.DrawIndexed(quad);
+
+    // Binding what is already bound is not a state change
+    commands.BindShader(shader.get());
+    commands.BindTexture(texture.get(), 0);
+    commands.BindTexture(texture.get(), 1);
+    commands.DrawIndexed(quad, 3);
+
+    commands.BindShader(other.get());
+    commands.SetUniform(other, UniformHandle<glm::vec4>(1), glm::vec4(1.0f));
+    commands.DrawIndexedInstanced(cube, 10);
+
+    RendererStats stats;
+    stats.Record(commands);
+    EXPECT_EQ(stats.DrawCalls, 3);
+    EXPECT_EQ(stats.Instances, 12);
+    EXPECT_EQ(stats.Indices, 6 + 3 + 36 * 10);
+    EXPECT_EQ(stats.Triangles, 2 + 1 + 12 * 10);
+    EXPECT_EQ(stats.ShaderBinds, 2);
+    EXPECT_EQ(stats.TextureBinds, 2);
+    EXPECT_EQ(stats.VertexArrayBinds, 2);
+    EXPECT_EQ(stats.UniformUploads, 2);
+    EXPECT_EQ(stats.UploadBytes, sizeof(glm::mat4) + sizeof(glm::vec4));
+
+    // Recording again adds to the counters
+    stats.Record(commands);
+    EXPECT_EQ(stats.DrawCalls, 6);
+}
+
+TEST(AntomicRendererTests, RendererFrameStatsTests)
+{
+    auto geometry = VertexArray::Create();
+    Ref<Material> material = CreateRef<StatsMaterial>();
+
+    RendererFrame frame(RendererViewport(800, 600), glm::mat4(1.0f));
+    for (int i = 0; i < 4; i++)
+    {
+        frame.QueueDrawable(CreateRef<Mesh>(geometry, material));
+    }
+    frame.QueueDrawable(CreateRef<Sprite>());
+    frame.QueueDrawable(CreateRef<Sprite>());
+
+    auto &stats = frame.GetStats();
+    EXPECT_EQ(stats.Meshes, 4);
+    EXPECT_EQ(stats.Sprites, 2);
+    EXPECT_EQ(stats.DrawCalls, 0);
+}
@@ -0,0 +1,120 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "gtest/gtest.h"
+#include "Renderer/RenderQueue.h"
+#include "Renderer/RendererFrame.h"
+#include "Renderer/Sprite.h"
+#include "Renderer/Texture.h"
+#include "glm/glm.hpp"
+
+using namespace Antomic;
+
+TEST(AntomicRendererTests, RenderKeyTests)
+{
+    // World goes before screen, lower z-order before higher
+    EXPECT_LT(RenderKey::Encode(RenderLayer::WORLD, 10, false, 0, 0, 0.f), RenderKey::Encode(RenderLayer::SCREEN, -10, false, 0, 0, 0.f));
+    EXPECT_LT(RenderKey::Encode(RenderLayer::SCREEN, -1, false, 0, 0, 0.f), RenderKey::Encode(RenderLayer::SCREEN, 0, false, 0, 0, 0.f));
+    EXPECT_EQ(RenderKey::GetLayer(RenderKey::Encode(RenderLayer::SCREEN, 0, true, 1, 2, 3.f)), RenderLayer::SCREEN);
+
+    // Opaque before translucent, state before depth
+    EXPECT_LT(RenderKey::Encode(RenderLayer::WORLD, 0, false, 1, 1, 100.f), RenderKey::Encode(RenderLayer::WORLD, 0, true, 0, 0, 0.f));
+    EXPECT_LT(RenderKey::Encode(RenderLayer::WORLD, 0, false, 0, 1, 100.f), RenderKey::Encode(RenderLayer::WORLD, 0, false, 1, 0, 1.f));
+    EXPECT_LT(RenderKey::Encode(RenderLayer::WORLD, 0, false, 0, 0, 1.f), RenderKey::Encode(RenderLayer::WORLD, 0, false, 0, 0, 100.f));
+
+    // Translucent world items are drawn back to front
+    EXPECT_LT(RenderKey::Encode(RenderLayer::WORLD, 0, true, 0, 0, 100.f), RenderKey::Encode(RenderLayer::WORLD, 0, true, 0, 0, 1.f));
+}
+
+TEST(AntomicRendererTests, RenderQueueTests)
+{
+    RenderQueue queue;
+    queue.Sort();
+    EXPECT_TRUE(queue.Empty());
+
+    std::vector<uint64_t> keys = {5, 0xff00000000000000ull, 3, 0x100, 3, 0, 0x0001000000000000ull, 5};
+    for (uint32_t i = 0; i < keys.size(); i++)
+    {
+        queue.Push(keys[i], i);
+    }
+    queue.Sort();
+
+    auto &items = queue.GetItems();
+    ASSERT_EQ(items.size(), keys.size());
+    for (size_t i = 1; i < items.size(); i++)
+    {
+        EXPECT_LE(items[i - 1].Key, items[i].Key);
+
+        // Equal keys keep their submission order
+        if (items[i - 1].Key == items[i].Key)
+        {
+            EXPECT_LT(items[i - 1].Index, items[i].Index);
+        }
+    }
+    EXPECT_EQ(items.front().Index, 5);
+    EXPECT_EQ(items.back().Index, 1);
+}
+
+TEST(AntomicRendererTests, RendererFrameSortTests)
+{
+    RendererFrame frame(RendererViewport(800, 600), glm::mat4(1.0f));
+
+    VectorRef<Sprite> sprites;
+    for (int zorder : {2, 0, 1, 0})
+    {
+        auto sprite = CreateRef<Sprite>();
+        sprite->SetZOrder(zorder);
+        frame.QueueDrawable(sprite);
+        sprites.push_back(sprite);
+    }
+
+    // Sprites follow the z-order, keeping submission order within it
+    auto &items = frame.Sort().GetItems();
+    ASSERT_EQ(items.size(), 4);
+    EXPECT_EQ(items[0].Index, 1);
+    EXPECT_EQ(items[1].Index, 3);
+    EXPECT_EQ(items[2].Index, 2);
+    EXPECT_EQ(items[3].Index, 0);
+}
+
+TEST(AntomicRendererTests, RendererFrameOverlapTests)
+{
+    RendererFrame frame(RendererViewport(800, 600), glm::mat4(1.0f));
+
+    // Overlapping sprites on one z-order, mixing translucent and opaque
+    // ones and two textures, are drawn exactly as submitted
+    auto first = Texture::CreateTexture(TextureSpecification());
+    auto second = Texture::CreateTexture(TextureSpecification());
+    std::vector<std::pair<float, Ref<Texture>>> setup = {{0.5f, first}, {1.0f, second}, {0.5f, second}, {1.0f, first}, {0.25f, first}};
+    for (auto &entry : setup)
+    {
+        auto sprite = CreateRef<Sprite>();
+        sprite->SetSpriteColor(glm::vec4(1.0f, 1.0f, 1.0f, entry.first));
+        sprite->SetTexture(entry.second);
+        frame.QueueDrawable(sprite);
+    }
+
+    auto &items = frame.Sort().GetItems();
+    ASSERT_EQ(items.size(), setup.size());
+    for (uint32_t i = 0; i < items.size(); i++)
+    {
+        EXPECT_EQ(items[i].Index, i);
+    }
+
+    // Screen keys keep the order below the z-order only
+    EXPECT_LT(RenderKey::EncodeScreen(0, 1), RenderKey::EncodeScreen(0, 2));
+    EXPECT_LT(RenderKey::EncodeScreen(0, 1000), RenderKey::EncodeScreen(1, 0));
+    EXPECT_EQ(RenderKey::GetLayer(RenderKey::EncodeScreen(-5, 3)), RenderLayer::SCREEN);
+}
@@ -0,0 +1,94 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "gtest/gtest.h"
+#include "Core/Base.h"
+#include "Renderer/Material.h"
+#include "Renderer/ResourceManager.h"
+#include "Renderer/Shader.h"
+
+using namespace Antomic;
+
+// Counts constructions to tell shared loads from new ones
+class SharedMaterial : public Material
+{
+public:
+    SharedMaterial(const std::string &vertexPath, const std::string &pixelPath)
+    {
+        mShader = ResourceManager::LoadShader(vertexPath, pixelPath);
+        sCreated++;
+    }
+
+public:
+    virtual void Bind() const override {}
+    virtual void Unbind() const override {}
+    virtual const Ref<Shader> &GetShader() const override { return mShader; }
+
+public:
+    static uint32_t sCreated;
+
+private:
+    Ref<Shader> mShader;
+};
+
+uint32_t SharedMaterial::sCreated = 0;
+
+static std::string WriteShaderSource(const std::string &name)
+{
+    auto path = (std::filesystem::temp_directory_path() / name).string();
+    std::ofstream(path) << "void main() {}\n";
+    return path;
+}
+
+TEST(AntomicRendererTests, ResourceManagerTests)
+{
+    auto vertex = WriteShaderSource("antomic_resource_vs.glsl");
+    auto pixel = WriteShaderSource("antomic_resource_fs.glsl");
+    auto key = "shader:" + vertex + "|" + pixel;
+    auto count = ResourceManager::GetResourceCount();
+
+    // Same paths share one shader, the manager holds no reference of its own
+    auto shader = ResourceManager::LoadShader(vertex, pixel);
+    ASSERT_NE(shader, nullptr);
+    EXPECT_EQ(ResourceManager::LoadShader(vertex, pixel), shader);
+    EXPECT_NE(ResourceManager::LoadShader(pixel, vertex), shader);
+    EXPECT_EQ(ResourceManager::GetUseCount(key), 1);
+
+    // Materials are keyed by type and name, and load their shaders shared
+    auto first = ResourceManager::LoadMaterial<SharedMaterial>("lit", vertex, pixel);
+    auto second = ResourceManager::LoadMaterial<SharedMaterial>("lit", vertex, pixel);
+    auto other = ResourceManager::LoadMaterial<SharedMaterial>("unlit", vertex, pixel);
+    EXPECT_EQ(first, second);
+    EXPECT_NE(first, other);
+    EXPECT_EQ(SharedMaterial::sCreated, 2);
+    EXPECT_EQ(first->GetShader(), shader);
+    EXPECT_EQ(other->GetShader(), shader);
+    EXPECT_EQ(ResourceManager::GetUseCount(key), 3);
+    EXPECT_EQ(ResourceManager::GetResourceCount(), count + 3);
+
+    // The last handle releases the resource, the next load creates it again
+    first = second = other = nullptr;
+    EXPECT_EQ(ResourceManager::GetUseCount(key), 1);
+    shader = nullptr;
+    EXPECT_EQ(ResourceManager::GetUseCount(key), 0);
+    EXPECT_EQ(ResourceManager::GetResourceCount(), count);
+
+    ResourceManager::Collect();
+    EXPECT_NE(ResourceManager::LoadMaterial<SharedMaterial>("lit", vertex, pixel), nullptr);
+    EXPECT_EQ(SharedMaterial::sCreated, 3);
+
+    std::filesystem::remove(vertex);
+    std::filesystem::remove(pixel);
+}
@@ -0,0 +1,66 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "gtest/gtest.h"
+#include "Core/Base.h"
+#include "Renderer/ShaderCache.h"
+
+using namespace Antomic;
+
+TEST(AntomicRendererTests, ShaderCacheTests)
+{
+    auto directory = std::filesystem::temp_directory_path() / "antomic_shader_cache_tests";
+    std::filesystem::remove_all(directory);
+    auto previous = ShaderCache::GetDirectory();
+    ShaderCache::SetDirectory(directory.string());
+
+    // Every part of the key matters, and parts do not run into each other
+    auto key = ShaderCache::Hash({"driver", "vertex", "pixel"});
+    EXPECT_EQ(key, ShaderCache::Hash({"driver", "vertex", "pixel"}));
+    EXPECT_NE(key, ShaderCache::Hash({"other driver", "vertex", "pixel"}));
+    EXPECT_NE(key, ShaderCache::Hash({"driver", "vertexp", "ixel"}));
+
+    uint32_t format = 0;
+    std::vector<uint8_t> binary;
+    EXPECT_FALSE(ShaderCache::Load(key, format, binary));
+
+    std::vector<uint8_t> stored = {1, 2, 3, 4, 5, 6, 7};
+    EXPECT_TRUE(ShaderCache::Store(key, 0x8741, stored));
+    EXPECT_TRUE(ShaderCache::Load(key, format, binary));
+    EXPECT_EQ(format, 0x8741);
+    EXPECT_EQ(binary, stored);
+
+    // Other keys never load this binary
+    EXPECT_FALSE(ShaderCache::Load(key + 1, format, binary));
+
+    ShaderCache::Remove(key);
+    EXPECT_FALSE(ShaderCache::Load(key, format, binary));
+
+    // Sizes not matching the file are a miss, the entry is removed
+    EXPECT_TRUE(ShaderCache::Store(key, 0x8741, stored));
+    for (auto &entry : std::filesystem::directory_iterator(directory))
+    {
+        std::filesystem::resize_file(entry.path(), entry.file_size() - 1);
+    }
+    EXPECT_FALSE(ShaderCache::Load(key, format, binary));
+    EXPECT_TRUE(std::filesystem::is_empty(directory));
+
+    // An empty directory disables the cache
+    ShaderCache::SetDirectory("");
+    EXPECT_FALSE(ShaderCache::Store(key, 0x8741, stored));
+
+    ShaderCache::SetDirectory(previous);
+    std::filesystem::remove_all(directory);
+}
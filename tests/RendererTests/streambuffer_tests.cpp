@@ -0,0 +1,60 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "gtest/gtest.h"
+#include "Renderer/StreamBuffer.h"
+
+using namespace Antomic;
+
+TEST(AntomicRendererTests, StreamBufferTests)
+{
+    auto buffer = StreamBuffer::Create(100, 3);
+    EXPECT_EQ(buffer->GetRegionSize(), 100);
+    EXPECT_EQ(buffer->GetRegionCount(), 3);
+
+    // Allocations are aligned within the current region
+    auto first = buffer->Allocate(10, 16);
+    ASSERT_NE(first.Data, nullptr);
+    EXPECT_EQ(first.Offset, 0);
+    EXPECT_EQ(first.Size, 10);
+
+    auto second = buffer->Allocate(12, 12);
+    EXPECT_EQ(second.Offset, 12);
+    EXPECT_EQ(second.Data, first.Data + 12);
+
+    // A full region is not left until Advance is called
+    EXPECT_EQ(buffer->Allocate(80, 16).Data, nullptr);
+    EXPECT_EQ(buffer->GetCurrentRegion(), 0);
+
+    buffer->Advance();
+    auto third = buffer->Allocate(80, 16);
+    EXPECT_EQ(buffer->GetCurrentRegion(), 1);
+    EXPECT_EQ(third.Offset, 112);
+
+    // Offsets are aligned to the whole buffer, not the region
+    auto fourth = buffer->Allocate(8, 24);
+    EXPECT_EQ(fourth.Offset % 24, 0);
+    EXPECT_EQ(fourth.Offset, 192);
+
+    // Advancing wraps around the regions
+    buffer->Advance();
+    EXPECT_EQ(buffer->GetCurrentRegion(), 2);
+    buffer->Advance();
+    EXPECT_EQ(buffer->GetCurrentRegion(), 0);
+    EXPECT_EQ(buffer->Allocate(4).Offset, 0);
+
+    // Bigger than a region can't be served
+    EXPECT_EQ(buffer->Allocate(101).Data, nullptr);
+}
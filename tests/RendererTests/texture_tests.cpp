@@ -0,0 +1,73 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "gtest/gtest.h"
+#include "Core/Base.h"
+#include "Renderer/Texture.h"
+
+using namespace Antomic;
+
+TEST(AntomicRendererTests, TextureFormatTests)
+{
+    EXPECT_EQ(TextureFormatChannels(TextureFormat::R8), 1);
+    EXPECT_EQ(TextureFormatChannels(TextureFormat::RG8), 2);
+    EXPECT_EQ(TextureFormatChannels(TextureFormat::SRGB8), 3);
+    EXPECT_EQ(TextureFormatChannels(TextureFormat::SRGBA8), 4);
+
+    EXPECT_EQ(TextureFormatFromChannels(1), TextureFormat::R8);
+    EXPECT_EQ(TextureFormatFromChannels(2), TextureFormat::RG8);
+    EXPECT_EQ(TextureFormatFromChannels(3), TextureFormat::RGB8);
+    EXPECT_EQ(TextureFormatFromChannels(4), TextureFormat::RGBA8);
+}
+
+TEST(AntomicRendererTests, TextureMemoryTests)
+{
+    EXPECT_EQ(Texture::GetMaxMipCount(1, 1), 1);
+    EXPECT_EQ(Texture::GetMaxMipCount(256, 256), 9);
+    EXPECT_EQ(Texture::GetMaxMipCount(300, 20), 9);
+
+    // Every level is counted, non square levels stop shrinking at 1
+    EXPECT_EQ(Texture::GetMemorySize(4, 4, TextureFormat::RGBA8, 1), 64);
+    EXPECT_EQ(Texture::GetMemorySize(4, 4, TextureFormat::RGBA8, 3), (16 + 4 + 1) * 4);
+    EXPECT_EQ(Texture::GetMemorySize(4, 1, TextureFormat::R8, 3), 4 + 2 + 1);
+
+    auto memory = Texture::GetAllocatedMemory();
+    auto count = Texture::GetAllocatedCount();
+
+    // Mips set to 0 allocates the full chain
+    TextureSpecification specification;
+    specification.Width = 8;
+    specification.Height = 4;
+    specification.Format = TextureFormat::RGB8;
+    specification.Mips = 0;
+    auto texture = Texture::CreateTexture(specification);
+    EXPECT_EQ(texture->GetMipCount(), 4);
+    EXPECT_EQ(texture->GetMemorySize(), (32 + 8 + 2 + 1) * 3);
+
+    // More mips than the size allows are clamped
+    specification.Format = TextureFormat::R8;
+    specification.Mips = 10;
+    auto mask = Texture::CreateTexture(specification);
+    EXPECT_EQ(mask->GetMipCount(), 4);
+    EXPECT_EQ(mask->GetMemorySize(), 32 + 8 + 2 + 1);
+
+    EXPECT_EQ(Texture::GetAllocatedCount(), count + 2);
+    EXPECT_EQ(Texture::GetAllocatedMemory(), memory + texture->GetMemorySize() + mask->GetMemorySize());
+
+    texture = nullptr;
+    mask = nullptr;
+    EXPECT_EQ(Texture::GetAllocatedCount(), count);
+    EXPECT_EQ(Texture::GetAllocatedMemory(), memory);
+}
@@ -0,0 +1,127 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "gtest/gtest.h"
+#include "Renderer/TextureAtlas.h"
+#include "glm/glm.hpp"
+
+using namespace Antomic;
+
+TEST(AntomicRendererTests, SkylinePackerTests)
+{
+    SkylinePacker packer(64, 64);
+    PackedRect rect;
+
+    // First rectangle goes to the bottom left corner
+    EXPECT_TRUE(packer.Pack(32, 16, rect));
+    EXPECT_EQ(rect.X, 0);
+    EXPECT_EQ(rect.Y, 0);
+
+    // Next one is placed on the lowest free segment
+    EXPECT_TRUE(packer.Pack(32, 8, rect));
+    EXPECT_EQ(rect.X, 32);
+    EXPECT_EQ(rect.Y, 0);
+
+    // This one rests on top of the lowest rectangle
+    EXPECT_TRUE(packer.Pack(32, 8, rect));
+    EXPECT_EQ(rect.X, 32);
+    EXPECT_EQ(rect.Y, 8);
+
+    // Spanning both segments rests on the highest one
+    EXPECT_TRUE(packer.Pack(64, 16, rect));
+    EXPECT_EQ(rect.X, 0);
+    EXPECT_EQ(rect.Y, 16);
+
+    EXPECT_EQ(packer.GetUsedArea(), 32 * 16 + 32 * 8 + 32 * 8 + 64 * 16);
+
+    // Too big for what is left
+    EXPECT_FALSE(packer.Pack(64, 48, rect));
+    EXPECT_FALSE(packer.Pack(65, 1, rect));
+
+    // Fill the page with small tiles, no tile may overlap
+    packer.Reset();
+    std::vector<PackedRect> rects;
+    while (packer.Pack(8, 8, rect))
+    {
+        for (auto &other : rects)
+        {
+            bool overlap = rect.X < other.X + other.Width && other.X < rect.X + rect.Width &&
+                           rect.Y < other.Y + other.Height && other.Y < rect.Y + rect.Height;
+            EXPECT_FALSE(overlap);
+        }
+        rects.push_back(rect);
+    }
+    EXPECT_EQ(rects.size(), 64);
+    EXPECT_EQ(packer.GetUsedArea(), 64 * 64);
+}
+
+TEST(AntomicRendererTests, TextureAtlasTests)
+{
+    TextureAtlas atlas(64, 0);
+    std::vector<unsigned char> pixels(32 * 32 * 4, 255);
+
+    auto a = atlas.Add("a", 32, 32, pixels.data());
+    ASSERT_NE(a, nullptr);
+    EXPECT_EQ(a->GetRect(), glm::vec4(0.f, 0.f, 0.5f, 0.5f));
+    EXPECT_EQ(atlas.Find("a"), a);
+    EXPECT_EQ(atlas.Find("b"), nullptr);
+
+    // Regions share the page texture
+    auto b = atlas.Add("b", 32, 32, pixels.data());
+    EXPECT_EQ(b->GetTexture(), a->GetTexture());
+    EXPECT_EQ(atlas.GetPageCount(), 1);
+
+    // Images bigger than a page are not packed
+    EXPECT_EQ(atlas.Add("big", 65, 1, pixels.data()), nullptr);
+
+    // Fill the first page and grow to a second one
+    auto c = atlas.Add("c", 64, 32, pixels.data());
+    auto d = atlas.Add("d", 32, 32, pixels.data());
+    EXPECT_EQ(atlas.GetPageCount(), 2);
+    EXPECT_NE(d->GetTexture(), a->GetTexture());
+
+    // Pages are evicted once no region uses them
+    a = nullptr;
+    b = nullptr;
+    c = nullptr;
+    atlas.Evict();
+    EXPECT_EQ(atlas.GetPageCount(), 1);
+    EXPECT_EQ(atlas.Find("a"), nullptr);
+    EXPECT_EQ(atlas.Find("d"), d);
+}
+
+TEST(AntomicRendererTests, TextureAtlasPaddingTests)
+{
+    // Regions start inside the padding on every side
+    TextureAtlas atlas(64, 1);
+    std::vector<unsigned char> pixels(30 * 30 * 4, 255);
+    auto a = atlas.Add("a", 30, 30, pixels.data());
+    ASSERT_NE(a, nullptr);
+    EXPECT_EQ(a->GetRect(), glm::vec4(1.f, 1.f, 31.f, 31.f) / 64.0f);
+    EXPECT_TRUE(atlas.Fits(62, 62));
+    EXPECT_FALSE(atlas.Fits(63, 62));
+
+    // The padding repeats the closest border texel
+    std::vector<unsigned char> image = {
+        1, 1, 1, 1, 2, 2, 2, 2,
+        3, 3, 3, 3, 4, 4, 4, 4};
+    auto padded = TextureAtlas::Pad(2, 2, image.data(), 1);
+    ASSERT_EQ(padded.size(), 4 * 4 * 4);
+    std::vector<unsigned char> expected = {1, 1, 2, 2, 1, 1, 2, 2, 3, 3, 4, 4, 3, 3, 4, 4};
+    for (size_t texel = 0; texel < expected.size(); texel++)
+    {
+        EXPECT_EQ(padded[texel * 4], expected[texel]);
+    }
+}
@@ -0,0 +1,212 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "gtest/gtest.h"
+#include "Core/Base.h"
+#include "Renderer/TextureContainer.h"
+#include "Renderer/TextureLoader.h"
+#include "Renderer/TextureAtlas.h"
+
+using namespace Antomic;
+
+template <typename T>
+static void Write(std::vector<uint8_t> &data, size_t offset, T value)
+{
+    if (data.size() < offset + sizeof(T))
+    {
+        data.resize(offset + sizeof(T));
+    }
+    std::memcpy(data.data() + offset, &value, sizeof(T));
+}
+
+// Each level is filled with its index so the order can be checked
+static void AppendLevels(std::vector<uint8_t> &data, uint32_t width, uint32_t height, TextureFormat format, uint32_t mips)
+{
+    for (uint32_t level = 0; level < mips; level++)
+    {
+        data.insert(data.end(), Texture::GetLevelSize(width, height, format, level), (uint8_t)level);
+    }
+}
+
+static std::vector<uint8_t> MakeDDS(uint32_t width, uint32_t height, uint32_t mips, const char *fourCC, uint32_t dxgiFormat, TextureFormat format)
+{
+    std::vector<uint8_t> data(128, 0);
+    Write<uint32_t>(data, 0, 0x20534444);
+    Write<uint32_t>(data, 4, 124);
+    Write<uint32_t>(data, 12, height);
+    Write<uint32_t>(data, 16, width);
+    Write<uint32_t>(data, 28, mips);
+    Write<uint32_t>(data, 76, 32);
+    std::memcpy(data.data() + 84, fourCC, 4);
+    if (dxgiFormat != 0)
+    {
+        data.resize(148, 0);
+        Write<uint32_t>(data, 128, dxgiFormat);
+        Write<uint32_t>(data, 132, 3);
+        Write<uint32_t>(data, 140, 1);
+    }
+    AppendLevels(data, width, height, format, mips);
+    return data;
+}
+
+// Levels are stored smallest first, as the KTX2 tools write them
+static std::vector<uint8_t> MakeKTX2(uint32_t width, uint32_t height, uint32_t mips, uint32_t vkFormat, TextureFormat format)
+{
+    const uint8_t identifier[12] = {0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'};
+    std::vector<uint8_t> data(80 + mips * 24, 0);
+    std::memcpy(data.data(), identifier, sizeof(identifier));
+    Write<uint32_t>(data, 12, vkFormat);
+    Write<uint32_t>(data, 16, 1);
+    Write<uint32_t>(data, 20, width);
+    Write<uint32_t>(data, 24, height);
+    Write<uint32_t>(data, 36, 1);
+    Write<uint32_t>(data, 40, mips);
+
+    for (int32_t level = mips - 1; level >= 0; level--)
+    {
+        auto size = Texture::GetLevelSize(width, height, format, level);
+        Write<uint64_t>(data, 80 + level * 24, data.size());
+        Write<uint64_t>(data, 88 + level * 24, size);
+        Write<uint64_t>(data, 96 + level * 24, size);
+        data.insert(data.end(), size, (uint8_t)level);
+    }
+    return data;
+}
+
+static void ExpectLevels(const TextureImage &image, uint32_t mips)
+{
+    ASSERT_EQ(image.Levels.size(), mips);
+    auto &specification = image.Specification;
+    EXPECT_EQ(image.Data.size(), Texture::GetMemorySize(specification.Width, specification.Height, specification.Format, mips));
+    for (uint32_t level = 0; level < mips; level++)
+    {
+        auto &entry = image.Levels[level];
+        EXPECT_EQ(entry.Width, std::max(1u, specification.Width >> level));
+        EXPECT_EQ(entry.Height, std::max(1u, specification.Height >> level));
+        EXPECT_EQ(entry.Size, Texture::GetLevelSize(specification.Width, specification.Height, specification.Format, level));
+        EXPECT_EQ(image.Data[entry.Offset], level);
+        EXPECT_EQ(image.Data[entry.Offset + entry.Size - 1], level);
+    }
+}
+
+TEST(AntomicRendererTests, TextureBlockSizeTests)
+{
+    EXPECT_TRUE(TextureFormatIsCompressed(TextureFormat::BC1));
+    EXPECT_TRUE(TextureFormatIsCompressed(TextureFormat::BC7SRGB));
+    EXPECT_FALSE(TextureFormatIsCompressed(TextureFormat::SRGBA8));
+
+    // Levels are padded to whole 4x4 blocks
+    EXPECT_EQ(Texture::GetLevelSize(16, 16, TextureFormat::BC1, 0), 16 * 8);
+    EXPECT_EQ(Texture::GetLevelSize(16, 16, TextureFormat::BC3, 0), 16 * 16);
+    EXPECT_EQ(Texture::GetLevelSize(16, 16, TextureFormat::BC1, 3), 8);
+    EXPECT_EQ(Texture::GetLevelSize(16, 16, TextureFormat::BC7, 4), 16);
+    EXPECT_EQ(Texture::GetLevelSize(6, 6, TextureFormat::BC4, 0), 4 * 8);
+    EXPECT_EQ(Texture::GetMemorySize(8, 8, TextureFormat::BC5, 4), (4 + 1 + 1 + 1) * 16);
+}
+
+TEST(AntomicRendererTests, TextureContainerDDSTests)
+{
+    EXPECT_TRUE(TextureContainer::IsContainer("sprites/player.DDS"));
+    EXPECT_TRUE(TextureContainer::IsContainer("sprites/player.ktx2"));
+    EXPECT_FALSE(TextureContainer::IsContainer("sprites/player.png"));
+
+    TextureImage image;
+    auto dxt5 = MakeDDS(16, 8, 5, "DXT5", 0, TextureFormat::BC3);
+    ASSERT_TRUE(TextureContainer::Parse(dxt5.data(), dxt5.size(), image));
+    EXPECT_EQ(image.Specification.Format, TextureFormat::BC3);
+    EXPECT_EQ(image.Specification.Width, 16);
+    EXPECT_EQ(image.Specification.Height, 8);
+    EXPECT_EQ(image.Specification.Mips, 5);
+    ExpectLevels(image, 5);
+
+    // Formats without a FourCC use the extended header
+    auto bc7 = MakeDDS(32, 32, 6, "DX10", 99, TextureFormat::BC7SRGB);
+    ASSERT_TRUE(TextureContainer::Parse(bc7.data(), bc7.size(), image));
+    EXPECT_EQ(image.Specification.Format, TextureFormat::BC7SRGB);
+    ExpectLevels(image, 6);
+
+    // Truncated data, unknown formats and too many levels are rejected
+    EXPECT_FALSE(TextureContainer::Parse(bc7.data(), bc7.size() - 1, image));
+    auto rgb = MakeDDS(4, 4, 1, "RGBG", 0, TextureFormat::RGBA8);
+    EXPECT_FALSE(TextureContainer::Parse(rgb.data(), rgb.size(), image));
+    auto deep = MakeDDS(4, 4, 4, "DXT1", 0, TextureFormat::BC1);
+    EXPECT_FALSE(TextureContainer::Parse(deep.data(), deep.size(), image));
+
+    // Dimensions the file can not hold are rejected before allocating
+    auto huge = MakeDDS(4, 4, 1, "DXT1", 0, TextureFormat::BC1);
+    Write<uint32_t>(huge, 12, 0xFFFFFFFF);
+    Write<uint32_t>(huge, 16, 0xFFFFFFFF);
+    Write<uint32_t>(huge, 28, 32);
+    EXPECT_FALSE(TextureContainer::Parse(huge.data(), huge.size(), image));
+    EXPECT_TRUE(image.Data.empty());
+    EXPECT_EQ(Texture::GetLevelSize(0xFFFFFFFF, 0xFFFFFFFF, TextureFormat::BC1, 0), std::numeric_limits<uint64_t>::max());
+}
+
+TEST(AntomicRendererTests, TextureContainerKTX2Tests)
+{
+    TextureImage image;
+    auto bc1 = MakeKTX2(64, 16, 7, 131, TextureFormat::BC1);
+    ASSERT_TRUE(TextureContainer::Parse(bc1.data(), bc1.size(), image));
+    EXPECT_EQ(image.Specification.Format, TextureFormat::BC1);
+    EXPECT_EQ(image.Specification.Width, 64);
+    EXPECT_EQ(image.Specification.Height, 16);
+    ExpectLevels(image, 7);
+
+    auto bc5 = MakeKTX2(8, 8, 1, 141, TextureFormat::BC5);
+    ASSERT_TRUE(TextureContainer::Parse(bc5.data(), bc5.size(), image));
+    EXPECT_EQ(image.Specification.Format, TextureFormat::BC5);
+    ExpectLevels(image, 1);
+
+    // Supercompressed and uncompressed files are not supported
+    auto zstd = bc5;
+    Write<uint32_t>(zstd, 44, 2);
+    EXPECT_FALSE(TextureContainer::Parse(zstd.data(), zstd.size(), image));
+    auto rgba = MakeKTX2(4, 4, 1, 37, TextureFormat::RGBA8);
+    EXPECT_FALSE(TextureContainer::Parse(rgba.data(), rgba.size(), image));
+    EXPECT_FALSE(TextureContainer::Parse(bc1.data(), 100, image));
+
+    auto huge = bc5;
+    Write<uint32_t>(huge, 20, 0xFFFFFFFF);
+    Write<uint32_t>(huge, 24, 0xFFFFFFFF);
+    EXPECT_FALSE(TextureContainer::Parse(huge.data(), huge.size(), image));
+}
+
+TEST(AntomicRendererTests, TextureLoaderCompressedTests)
+{
+    auto path = (std::filesystem::temp_directory_path() / "antomic_loader_test.dds").string();
+    auto dds = MakeDDS(8, 8, 4, "DXT1", 0, TextureFormat::BC1);
+    std::ofstream(path, std::ios::binary).write((const char *)dds.data(), dds.size());
+
+    TextureLoader loader(1, 1024);
+    Ref<TextureRegion> region;
+    loader.Load(path, [&](const Ref<TextureRegion> &loaded) { region = loaded; });
+    for (int i = 0; i < 1000 && loader.GetPendingCount() > 0; i++)
+    {
+        loader.Upload();
+        loader.Dispatch();
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    // Compressed images get a texture of their own with the file's mips
+    ASSERT_NE(region, nullptr);
+    auto &texture = region->GetTexture();
+    EXPECT_EQ(texture->GetFormat(), TextureFormat::BC1);
+    EXPECT_EQ(texture->GetMipCount(), 4);
+    EXPECT_EQ(texture->GetMemorySize(), (4 + 1 + 1 + 1) * 8);
+    EXPECT_EQ(region->GetRect(), glm::vec4(0.0f, 0.0f, 1.0f, 1.0f));
+
+    loader.Shutdown();
+    std::filesystem::remove(path);
+}
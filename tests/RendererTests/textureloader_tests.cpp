@@ -0,0 +1,124 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "gtest/gtest.h"
+#include "Core/Base.h"
+#include "Renderer/TextureLoader.h"
+#include "Renderer/TextureAtlas.h"
+
+using namespace Antomic;
+
+// Binary PPM, one of the formats the decoder reads
+static std::string WriteTestImage(const std::string &name, uint32_t width, uint32_t height)
+{
+    auto path = (std::filesystem::temp_directory_path() / name).string();
+    std::ofstream file(path, std::ios::binary);
+    file << "P6\n" << width << " " << height << "\n255\n";
+    std::vector<char> pixels(width * height * 3, (char)128);
+    file.write(pixels.data(), pixels.size());
+    return path;
+}
+
+// Runs the render and main thread sides until nothing is pending
+static bool WaitForLoads(TextureLoader &loader)
+{
+    for (int i = 0; i < 1000 && loader.GetPendingCount() > 0; i++)
+    {
+        loader.Upload();
+        loader.Dispatch();
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return loader.GetPendingCount() == 0;
+}
+
+TEST(AntomicRendererTests, TextureLoaderTests)
+{
+    auto image = WriteTestImage("antomic_loader_test.ppm", 4, 2);
+    TextureLoader loader(2, 1024);
+
+    // Requests for the same image share one load, and nothing is called
+    // back before the upload
+    int loaded = 0;
+    Ref<TextureRegion> first, second;
+    loader.Load(image, [&](const Ref<TextureRegion> &region) { first = region; loaded++; });
+    loader.Load(image, [&](const Ref<TextureRegion> &region) { second = region; loaded++; });
+    EXPECT_EQ(loaded, 0);
+    EXPECT_EQ(loader.GetPendingCount(), 1);
+
+    ASSERT_TRUE(WaitForLoads(loader));
+    EXPECT_EQ(loaded, 2);
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first, second);
+    EXPECT_NE(first->GetTexture(), nullptr);
+
+    // Resident images call back right away
+    Ref<TextureRegion> third;
+    loader.Load(image, [&](const Ref<TextureRegion> &region) { third = region; });
+    EXPECT_EQ(third, first);
+
+    // Missing images report a null region
+    bool failed = false;
+    loader.Load("does/not/exist.png", [&](const Ref<TextureRegion> &region) { failed = region == nullptr; });
+    ASSERT_TRUE(WaitForLoads(loader));
+    EXPECT_TRUE(failed);
+
+    loader.Shutdown();
+    first = second = third = nullptr;
+    TextureAtlas::Get().Evict();
+    std::filesystem::remove(image);
+}
+
+TEST(AntomicRendererTests, TextureLoaderBudgetTests)
+{
+    // 24 bytes each, the budget fits two images per frame
+    std::vector<std::string> images;
+    for (int i = 0; i < 5; i++)
+    {
+        images.push_back(WriteTestImage("antomic_budget_test_" + std::to_string(i) + ".ppm", 4, 2));
+    }
+
+    TextureLoader loader(1, 48);
+    int loaded = 0;
+    VectorRef<TextureRegion> regions;
+    for (auto &image : images)
+    {
+        loader.Load(image, [&](const Ref<TextureRegion> &region) { regions.push_back(region); loaded++; });
+    }
+
+    // Wait for every decode before uploading anything
+    for (int i = 0; i < 1000; i++)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        loader.Upload();
+        loader.Dispatch();
+        if (loaded > 0)
+        {
+            break;
+        }
+    }
+
+    // Whatever was decoded, a frame never uploads more than the budget
+    EXPECT_LE(loaded, 2);
+    ASSERT_TRUE(WaitForLoads(loader));
+    EXPECT_EQ(loaded, 5);
+
+    loader.Shutdown();
+    regions.clear();
+    TextureAtlas::Get().Evict();
+    for (auto &image : images)
+    {
+        std::filesystem::remove(image);
+    }
+}
@@ -0,0 +1,79 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "gtest/gtest.h"
+#include "Renderer/Buffers.h"
+#include "glm/glm.hpp"
+
+using namespace Antomic;
+
+class TestUniformBuffer : public UniformBuffer
+{
+public:
+    TestUniformBuffer(const UniformBufferLayout &layout) : UniformBuffer(layout) {}
+
+public:
+    std::vector<std::pair<uint32_t, uint32_t>> Uploads;
+
+protected:
+    virtual void Upload(uint32_t offset, uint32_t size, const void *data) override { Uploads.push_back({offset, size}); }
+};
+
+TEST(AntomicRendererTests, UniformBufferTests)
+{
+    UniformBufferLayout layout = {
+        {ShaderDataType::Mat4, "m_proj"},
+        {ShaderDataType::Mat4, "m_view"},
+        {ShaderDataType::Mat4, "m_projview"},
+        {ShaderDataType::Mat4, "m_ortho"},
+        {ShaderDataType::Vec3, "vector"},
+        {ShaderDataType::Float, "value"},
+        {ShaderDataType::Mat3, "normal"}};
+
+    TestUniformBuffer buffer(layout);
+    EXPECT_EQ(buffer.GetData().size(), layout.Stride());
+    EXPECT_FALSE(buffer.IsDirty());
+    EXPECT_EQ(buffer.Flush(), 0);
+
+    // Neighbour values are merged into a single upload
+    buffer.SetValue("m_projview", glm::mat4(2.0f));
+    buffer.SetValue("m_view", glm::mat4(1.0f));
+    EXPECT_TRUE(buffer.IsDirty());
+    EXPECT_EQ(buffer.Flush(), 1);
+    ASSERT_EQ(buffer.Uploads.size(), 1);
+    EXPECT_EQ(buffer.Uploads[0].first, 64);
+    EXPECT_EQ(buffer.Uploads[0].second, 128);
+    EXPECT_FALSE(buffer.IsDirty());
+
+    // Distant values are uploaded separately
+    buffer.Uploads.clear();
+    buffer.SetValue("m_proj", glm::mat4(1.0f));
+    buffer.SetValue("value", 3.0f);
+    EXPECT_EQ(buffer.Flush(), 2);
+
+    // Writing a vec3 leaves the next value untouched
+    buffer.SetValue("vector", glm::vec3(1.0f));
+    float value;
+    std::memcpy(&value, buffer.GetData().data() + layout.GetElement("value").Offset, sizeof(float));
+    EXPECT_EQ(value, 3.0f);
+
+    // Each mat3 column is padded to a vec4
+    buffer.SetValue("normal", glm::mat3(1.0f));
+    auto normal = layout.GetElement("normal").Offset;
+    std::memcpy(&value, buffer.GetData().data() + normal + 4 * sizeof(float), sizeof(float));
+    EXPECT_EQ(value, 0.0f);
+    std::memcpy(&value, buffer.GetData().data() + normal + 5 * sizeof(float), sizeof(float));
+    EXPECT_EQ(value, 1.0f);
+}
@@ -0,0 +1,70 @@
+/*
+   Copyright 2020 Alexandre Pires (c.alexandre.pires@gmail.com)
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "Core/Base.h"
+#include "Core/Archive.h"
+#include <iostream>
+
+using namespace Antomic;
+
+// Packs a directory tree into an archive, paths are stored as they are
+// reached from the working directory, e.g. assets/shaders/2d/vs_sprite.glsl
+int main(int argc, char **argv)
+{
+    if (argc != 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <assets directory> <archive>" << std::endl;
+        return 1;
+    }
+
+    std::filesystem::path root(argv[1]);
+    if (!std::filesystem::is_directory(root))
+    {
+        std::cerr << "Not a directory: " << root.string() << std::endl;
+        return 1;
+    }
+
+    // Sorted so the same tree always cooks the same archive
+    std::vector<std::string> files;
+    for (auto &entry : std::filesystem::recursive_directory_iterator(root))
+    {
+        if (entry.is_regular_file())
+        {
+            files.push_back(entry.path().lexically_normal().generic_string());
+        }
+    }
+    std::sort(files.begin(), files.end());
+
+    ArchiveWriter writer;
+    uint64_t bytes = 0;
+    for (auto &file : files)
+    {
+        if (!writer.AddFile(file))
+        {
+            std::cerr << "Could not add " << file << ", unreadable or its hash collides" << std::endl;
+            return 1;
+        }
+        bytes += std::filesystem::file_size(file);
+    }
+
+    if (!writer.Write(argv[2]))
+    {
+        std::cerr << "Could not write " << argv[2] << std::endl;
+        return 1;
+    }
+
+    std::cout << "Cooked " << files.size() << " files, " << bytes << " bytes into " << argv[2] << std::endl;
+    return 0;
+}